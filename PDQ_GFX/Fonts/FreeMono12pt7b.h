@@ -219,9 +219,16 @@ const GFXglyph FreeMono12pt7bGlyphs[] PROGMEM = {
   {  1444,   5,  18,  14,    5,  -14 },   // 0x7D '}'
   {  1456,  10,   3,  14,    2,   -7 } }; // 0x7E '~'
 
+const GFXmetrics FreeMono12pt7bMetrics PROGMEM = {
+  15, 4, GFX_FIXED_WIDTH, 14, NULL };
+
 const GFXfont FreeMono12pt7b PROGMEM = {
   (uint8_t  *)FreeMono12pt7bBitmaps,
   (GFXglyph *)FreeMono12pt7bGlyphs,
-  0x20, 0x7E, 24 };
+  0x20, 0x7E, 24,
+  (GFXmetrics *)&FreeMono12pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 2132 bytes
+// Approx. 2146 bytes
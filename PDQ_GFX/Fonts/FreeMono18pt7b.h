@@ -355,9 +355,16 @@ const GFXglyph FreeMono18pt7bGlyphs[] PROGMEM = {
   {  3054,   8,  25,  21,    7,  -20 },   // 0x7D '}'
   {  3079,  15,   5,  21,    3,  -11 } }; // 0x7E '~'
 
+const GFXmetrics FreeMono18pt7bMetrics PROGMEM = {
+  22, 7, GFX_FIXED_WIDTH, 21, NULL };
+
 const GFXfont FreeMono18pt7b PROGMEM = {
   (uint8_t  *)FreeMono18pt7bBitmaps,
   (GFXglyph *)FreeMono18pt7bGlyphs,
-  0x20, 0x7E, 35 };
+  0x20, 0x7E, 35,
+  (GFXmetrics *)&FreeMono18pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 3761 bytes
+// Approx. 3775 bytes
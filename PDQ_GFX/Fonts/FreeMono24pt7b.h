@@ -569,9 +569,16 @@ const GFXglyph FreeMono24pt7bGlyphs[] PROGMEM = {
   {  5596,  11,  34,  28,    9,  -27 },   // 0x7D '}'
   {  5643,  20,   6,  28,    4,  -15 } }; // 0x7E '~'
 
+const GFXmetrics FreeMono24pt7bMetrics PROGMEM = {
+  30, 9, GFX_FIXED_WIDTH, 28, NULL };
+
 const GFXfont FreeMono24pt7b PROGMEM = {
   (uint8_t  *)FreeMono24pt7bBitmaps,
   (GFXglyph *)FreeMono24pt7bGlyphs,
-  0x20, 0x7E, 47 };
+  0x20, 0x7E, 47,
+  (GFXmetrics *)&FreeMono24pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 6330 bytes
+// Approx. 6344 bytes
@@ -168,9 +168,16 @@ const GFXglyph FreeMono9pt7bGlyphs[] PROGMEM = {
   {   836,   3,  13,  11,    4,  -10 },   // 0x7D '}'
   {   841,   7,   3,  11,    2,   -6 } }; // 0x7E '~'
 
+const GFXmetrics FreeMono9pt7bMetrics PROGMEM = {
+  11, 3, GFX_FIXED_WIDTH, 11, NULL };
+
 const GFXfont FreeMono9pt7b PROGMEM = {
   (uint8_t  *)FreeMono9pt7bBitmaps,
   (GFXglyph *)FreeMono9pt7bGlyphs,
-  0x20, 0x7E, 18 };
+  0x20, 0x7E, 18,
+  (GFXmetrics *)&FreeMono9pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 1516 bytes
+// Approx. 1530 bytes
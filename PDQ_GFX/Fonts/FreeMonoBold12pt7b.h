@@ -242,9 +242,24 @@ const GFXglyph FreeMonoBold12pt7bGlyphs[] PROGMEM = {
   {  1707,   7,  19,  14,    4,  -14 },   // 0x7D '}'
   {  1724,  12,   4,  14,    1,   -7 } }; // 0x7E '~'
 
+const uint8_t FreeMonoBold12pt7bAdvances[] PROGMEM = {
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14 };
+
+const GFXmetrics FreeMonoBold12pt7bMetrics PROGMEM = {
+  16, 5, 0, 0, (uint8_t *)FreeMonoBold12pt7bAdvances };
+
 const GFXfont FreeMonoBold12pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBold12pt7bBitmaps,
   (GFXglyph *)FreeMonoBold12pt7bGlyphs,
-  0x20, 0x7E, 24 };
+  0x20, 0x7E, 24,
+  (GFXmetrics *)&FreeMonoBold12pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 2402 bytes
+// Approx. 2511 bytes
@@ -415,9 +415,24 @@ const GFXglyph FreeMonoBold18pt7bGlyphs[] PROGMEM = {
   {  3762,  10,  27,  21,    6,  -21 },   // 0x7D '}'
   {  3796,  17,   8,  21,    2,  -13 } }; // 0x7E '~'
 
+const uint8_t FreeMonoBold18pt7bAdvances[] PROGMEM = {
+   21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+   21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+   21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+   21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+   21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+   21, 22, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21 };
+
+const GFXmetrics FreeMonoBold18pt7bMetrics PROGMEM = {
+  23, 7, 0, 0, (uint8_t *)FreeMonoBold18pt7bAdvances };
+
 const GFXfont FreeMonoBold18pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBold18pt7bBitmaps,
   (GFXglyph *)FreeMonoBold18pt7bGlyphs,
-  0x20, 0x7E, 35 };
+  0x20, 0x7E, 35,
+  (GFXmetrics *)&FreeMonoBold18pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 4485 bytes
+// Approx. 4594 bytes
@@ -664,9 +664,16 @@ const GFXglyph FreeMonoBold24pt7bGlyphs[] PROGMEM = {
   {  6704,  14,  37,  28,    8,  -29 },   // 0x7D '}'
   {  6769,  22,  10,  28,    3,  -17 } }; // 0x7E '~'
 
+const GFXmetrics FreeMonoBold24pt7bMetrics PROGMEM = {
+  32, 9, GFX_FIXED_WIDTH, 28, NULL };
+
 const GFXfont FreeMonoBold24pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBold24pt7bBitmaps,
   (GFXglyph *)FreeMonoBold24pt7bGlyphs,
-  0x20, 0x7E, 47 };
+  0x20, 0x7E, 47,
+  (GFXmetrics *)&FreeMonoBold24pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 7469 bytes
+// Approx. 7483 bytes
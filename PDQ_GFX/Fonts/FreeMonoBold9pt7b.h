@@ -181,9 +181,16 @@ const GFXglyph FreeMonoBold9pt7bGlyphs[] PROGMEM = {
   {   988,   4,  14,  11,    4,  -10 },   // 0x7D '}'
   {   995,   9,   4,  11,    1,   -6 } }; // 0x7E '~'
 
+const GFXmetrics FreeMonoBold9pt7bMetrics PROGMEM = {
+  12, 4, GFX_FIXED_WIDTH, 11, NULL };
+
 const GFXfont FreeMonoBold9pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBold9pt7bBitmaps,
   (GFXglyph *)FreeMonoBold9pt7bGlyphs,
-  0x20, 0x7E, 18 };
+  0x20, 0x7E, 18,
+  (GFXmetrics *)&FreeMonoBold9pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 1672 bytes
+// Approx. 1686 bytes
@@ -261,9 +261,16 @@ const GFXglyph FreeMonoBoldOblique12pt7bGlyphs[] PROGMEM = {
   {  1938,   9,  19,  14,    3,  -14 },   // 0x7D '}'
   {  1960,  12,   4,  14,    3,   -7 } }; // 0x7E '~'
 
+const GFXmetrics FreeMonoBoldOblique12pt7bMetrics PROGMEM = {
+  16, 5, GFX_FIXED_WIDTH, 14, NULL };
+
 const GFXfont FreeMonoBoldOblique12pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBoldOblique12pt7bBitmaps,
   (GFXglyph *)FreeMonoBoldOblique12pt7bGlyphs,
-  0x20, 0x7E, 24 };
+  0x20, 0x7E, 24,
+  (GFXmetrics *)&FreeMonoBoldOblique12pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 2638 bytes
+// Approx. 2652 bytes
@@ -452,9 +452,16 @@ const GFXglyph FreeMonoBoldOblique18pt7bGlyphs[] PROGMEM = {
   {  4195,  13,  27,  21,    4,  -21 },   // 0x7D '}'
   {  4239,  17,   8,  21,    4,  -13 } }; // 0x7E '~'
 
+const GFXmetrics FreeMonoBoldOblique18pt7bMetrics PROGMEM = {
+  23, 7, GFX_FIXED_WIDTH, 21, NULL };
+
 const GFXfont FreeMonoBoldOblique18pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBoldOblique18pt7bBitmaps,
   (GFXglyph *)FreeMonoBoldOblique18pt7bGlyphs,
-  0x20, 0x7E, 35 };
+  0x20, 0x7E, 35,
+  (GFXmetrics *)&FreeMonoBoldOblique18pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 4928 bytes
+// Approx. 4942 bytes
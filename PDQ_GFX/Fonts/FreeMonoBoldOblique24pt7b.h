@@ -734,9 +734,16 @@ const GFXglyph FreeMonoBoldOblique24pt7bGlyphs[] PROGMEM = {
   {  7527,  17,  37,  28,    6,  -29 },   // 0x7D '}'
   {  7606,  23,  10,  28,    5,  -17 } }; // 0x7E '~'
 
+const GFXmetrics FreeMonoBoldOblique24pt7bMetrics PROGMEM = {
+  32, 9, GFX_FIXED_WIDTH, 28, NULL };
+
 const GFXfont FreeMonoBoldOblique24pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBoldOblique24pt7bBitmaps,
   (GFXglyph *)FreeMonoBoldOblique24pt7bGlyphs,
-  0x20, 0x7E, 47 };
+  0x20, 0x7E, 47,
+  (GFXmetrics *)&FreeMonoBoldOblique24pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 8307 bytes
+// Approx. 8321 bytes
@@ -195,9 +195,16 @@ const GFXglyph FreeMonoBoldOblique9pt7bGlyphs[] PROGMEM = {
   {  1148,   8,  14,  11,    2,  -10 },   // 0x7D '}'
   {  1162,   9,   4,  11,    2,   -6 } }; // 0x7E '~'
 
+const GFXmetrics FreeMonoBoldOblique9pt7bMetrics PROGMEM = {
+  12, 4, GFX_FIXED_WIDTH, 11, NULL };
+
 const GFXfont FreeMonoBoldOblique9pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBoldOblique9pt7bBitmaps,
   (GFXglyph *)FreeMonoBoldOblique9pt7bGlyphs,
-  0x20, 0x7E, 18 };
+  0x20, 0x7E, 18,
+  (GFXmetrics *)&FreeMonoBoldOblique9pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 1839 bytes
+// Approx. 1853 bytes
@@ -240,9 +240,16 @@ const GFXglyph FreeMonoOblique12pt7bGlyphs[] PROGMEM = {
   {  1686,   7,  18,  14,    4,  -14 },   // 0x7D '}'
   {  1702,  11,   3,  14,    3,   -7 } }; // 0x7E '~'
 
+const GFXmetrics FreeMonoOblique12pt7bMetrics PROGMEM = {
+  15, 4, GFX_FIXED_WIDTH, 14, NULL };
+
 const GFXfont FreeMonoOblique12pt7b PROGMEM = {
   (uint8_t  *)FreeMonoOblique12pt7bBitmaps,
   (GFXglyph *)FreeMonoOblique12pt7bGlyphs,
-  0x20, 0x7E, 24 };
+  0x20, 0x7E, 24,
+  (GFXmetrics *)&FreeMonoOblique12pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 2379 bytes
+// Approx. 2393 bytes
@@ -390,9 +390,16 @@ const GFXglyph FreeMonoOblique18pt7bGlyphs[] PROGMEM = {
   {  3472,  10,  25,  21,    6,  -20 },   // 0x7D '}'
   {  3504,  15,   5,  21,    5,  -11 } }; // 0x7E '~'
 
+const GFXmetrics FreeMonoOblique18pt7bMetrics PROGMEM = {
+  22, 7, GFX_FIXED_WIDTH, 21, NULL };
+
 const GFXfont FreeMonoOblique18pt7b PROGMEM = {
   (uint8_t  *)FreeMonoOblique18pt7bBitmaps,
   (GFXglyph *)FreeMonoOblique18pt7bGlyphs,
-  0x20, 0x7E, 35 };
+  0x20, 0x7E, 35,
+  (GFXmetrics *)&FreeMonoOblique18pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 4186 bytes
+// Approx. 4200 bytes
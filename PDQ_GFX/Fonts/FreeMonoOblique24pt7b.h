@@ -635,9 +635,16 @@ const GFXglyph FreeMonoOblique24pt7bGlyphs[] PROGMEM = {
   {  6373,  15,  34,  28,    8,  -27 },   // 0x7D '}'
   {  6437,  20,   6,  28,    7,  -15 } }; // 0x7E '~'
 
+const GFXmetrics FreeMonoOblique24pt7bMetrics PROGMEM = {
+  30, 9, GFX_FIXED_WIDTH, 28, NULL };
+
 const GFXfont FreeMonoOblique24pt7b PROGMEM = {
   (uint8_t  *)FreeMonoOblique24pt7bBitmaps,
   (GFXglyph *)FreeMonoOblique24pt7bGlyphs,
-  0x20, 0x7E, 47 };
+  0x20, 0x7E, 47,
+  (GFXmetrics *)&FreeMonoOblique24pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 7124 bytes
+// Approx. 7138 bytes
@@ -179,9 +179,16 @@ const GFXglyph FreeMonoOblique9pt7bGlyphs[] PROGMEM = {
   {   969,   6,  13,  11,    3,  -10 },   // 0x7D '}'
   {   979,   7,   3,  11,    3,   -6 } }; // 0x7E '~'
 
+const GFXmetrics FreeMonoOblique9pt7bMetrics PROGMEM = {
+  11, 3, GFX_FIXED_WIDTH, 11, NULL };
+
 const GFXfont FreeMonoOblique9pt7b PROGMEM = {
   (uint8_t  *)FreeMonoOblique9pt7bBitmaps,
   (GFXglyph *)FreeMonoOblique9pt7bGlyphs,
-  0x20, 0x7E, 18 };
+  0x20, 0x7E, 18,
+  (GFXmetrics *)&FreeMonoOblique9pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 1654 bytes
+// Approx. 1668 bytes
@@ -262,9 +262,24 @@ const GFXglyph FreeSans12pt7bGlyphs[] PROGMEM = {
   {  1947,   5,  23,   8,    2,  -17 },   // 0x7D '}'
   {  1962,  10,   5,  12,    1,  -10 } }; // 0x7E '~'
 
+const uint8_t FreeSans12pt7bAdvances[] PROGMEM = {
+    6,  8,  8, 13, 13, 21, 16,  5,  8,  8,  9, 14,  7,  8,  6,  7,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  6,  6, 14, 14, 14, 13,
+   24, 16, 16, 17, 17, 15, 14, 18, 17,  7, 13, 16, 14, 20, 18, 19,
+   16, 19, 17, 16, 15, 17, 15, 22, 16, 16, 15,  7,  7,  7, 11, 13,
+    6, 13, 13, 12, 13, 13,  7, 13, 13,  5,  6, 12,  5, 19, 13, 13,
+   13, 13,  8, 12,  7, 13, 12, 17, 11, 11, 12,  8,  6,  8, 12 };
+
+const GFXmetrics FreeSans12pt7bMetrics PROGMEM = {
+  17, 5, 0, 0, (uint8_t *)FreeSans12pt7bAdvances };
+
 const GFXfont FreeSans12pt7b PROGMEM = {
   (uint8_t  *)FreeSans12pt7bBitmaps,
   (GFXglyph *)FreeSans12pt7bGlyphs,
-  0x20, 0x7E, 29 };
+  0x20, 0x7E, 29,
+  (GFXmetrics *)&FreeSans12pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 2641 bytes
+// Approx. 2750 bytes
@@ -444,9 +444,24 @@ const GFXglyph FreeSans18pt7bGlyphs[] PROGMEM = {
   {  4112,   8,  33,  12,    3,  -25 },   // 0x7D '}'
   {  4145,  15,   7,  18,    1,  -15 } }; // 0x7E '~'
 
+const uint8_t FreeSans18pt7bAdvances[] PROGMEM = {
+    9, 12, 12, 19, 19, 31, 23,  7, 12, 12, 14, 20, 10, 12,  9, 10,
+   19, 19, 19, 19, 19, 19, 19, 19, 19, 19,  9,  9, 20, 20, 20, 19,
+   36, 23, 23, 25, 24, 22, 21, 27, 25, 10, 18, 24, 20, 30, 26, 27,
+   23, 27, 25, 23, 22, 25, 23, 33, 23, 24, 22, 10, 10, 10, 16, 19,
+    9, 19, 20, 18, 20, 19, 10, 19, 19,  8,  9, 18,  7, 28, 19, 19,
+   20, 20, 12, 17, 10, 19, 17, 25, 17, 17, 17, 12,  9, 12, 18 };
+
+const GFXmetrics FreeSans18pt7bMetrics PROGMEM = {
+  26, 8, 0, 0, (uint8_t *)FreeSans18pt7bAdvances };
+
 const GFXfont FreeSans18pt7b PROGMEM = {
   (uint8_t  *)FreeSans18pt7bBitmaps,
   (GFXglyph *)FreeSans18pt7bGlyphs,
-  0x20, 0x7E, 42 };
+  0x20, 0x7E, 42,
+  (GFXmetrics *)&FreeSans18pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 4831 bytes
+// Approx. 4940 bytes
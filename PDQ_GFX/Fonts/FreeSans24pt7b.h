@@ -719,9 +719,24 @@ const GFXglyph FreeSans24pt7bGlyphs[] PROGMEM = {
   {  7386,  11,  44,  16,    2,  -33 },   // 0x7D '}'
   {  7447,  19,   7,  24,    2,  -19 } }; // 0x7E '~'
 
+const uint8_t FreeSans24pt7bAdvances[] PROGMEM = {
+   12, 16, 16, 26, 26, 42, 31,  9, 16, 16, 18, 27, 13, 16, 12, 13,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 12, 12, 27, 27, 27, 26,
+   48, 31, 31, 33, 33, 30, 28, 36, 34, 13, 25, 32, 26, 40, 34, 37,
+   31, 37, 33, 31, 30, 34, 30, 44, 31, 32, 29, 13, 13, 13, 22, 26,
+   12, 26, 26, 24, 26, 25, 13, 26, 25, 10, 11, 24, 10, 38, 25, 25,
+   26, 26, 16, 23, 13, 25, 23, 34, 22, 22, 23, 16, 12, 16, 24 };
+
+const GFXmetrics FreeSans24pt7bMetrics PROGMEM = {
+  34, 10, 0, 0, (uint8_t *)FreeSans24pt7bAdvances };
+
 const GFXfont FreeSans24pt7b PROGMEM = {
   (uint8_t  *)FreeSans24pt7bBitmaps,
   (GFXglyph *)FreeSans24pt7bGlyphs,
-  0x20, 0x7E, 56 };
+  0x20, 0x7E, 56,
+  (GFXmetrics *)&FreeSans24pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 8136 bytes
+// Approx. 8245 bytes
@@ -193,9 +193,24 @@ const GFXglyph FreeSans9pt7bGlyphs[] PROGMEM = {
   {  1138,   4,  17,   6,    1,  -12 },   // 0x7D '}'
   {  1147,   7,   3,   9,    1,   -7 } }; // 0x7E '~'
 
+const uint8_t FreeSans9pt7bAdvances[] PROGMEM = {
+    5,  6,  6, 10, 10, 16, 12,  4,  6,  6,  7, 11,  5,  6,  5,  5,
+   10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  5,  5, 11, 11, 11, 10,
+   18, 12, 12, 13, 13, 11, 11, 14, 13,  5, 10, 12, 10, 15, 13, 14,
+   12, 14, 13, 12, 11, 13, 12, 17, 12, 12, 11,  5,  5,  5,  8, 10,
+    5, 10, 10,  9, 10, 10,  5, 10, 10,  4,  4,  9,  4, 15, 10, 10,
+   10, 10,  6,  9,  5, 10,  9, 13,  9,  9,  9,  6,  4,  6,  9 };
+
+const GFXmetrics FreeSans9pt7bMetrics PROGMEM = {
+  13, 4, 0, 0, (uint8_t *)FreeSans9pt7bAdvances };
+
 const GFXfont FreeSans9pt7b PROGMEM = {
   (uint8_t  *)FreeSans9pt7bBitmaps,
   (GFXglyph *)FreeSans9pt7bGlyphs,
-  0x20, 0x7E, 22 };
+  0x20, 0x7E, 22,
+  (GFXmetrics *)&FreeSans9pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 1822 bytes
+// Approx. 1931 bytes
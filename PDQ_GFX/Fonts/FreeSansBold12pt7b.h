@@ -280,9 +280,24 @@ const GFXglyph FreeSansBold12pt7bGlyphs[] PROGMEM = {
   {  2160,   6,  23,   9,    3,  -17 },   // 0x7D '}'
   {  2178,  12,   5,  12,    0,   -7 } }; // 0x7E '~'
 
+const uint8_t FreeSansBold12pt7bAdvances[] PROGMEM = {
+    7,  8, 11, 13, 13, 21, 17,  6,  8,  8,  9, 14,  6,  8,  6,  7,
+   13, 14, 13, 13, 13, 13, 13, 13, 13, 13,  6,  6, 14, 14, 14, 15,
+   23, 17, 17, 17, 17, 16, 15, 18, 18,  7, 14, 17, 15, 21, 18, 19,
+   16, 19, 17, 16, 15, 18, 16, 23, 16, 15, 15,  8,  7,  8, 14, 13,
+    6, 14, 15, 13, 15, 14,  8, 15, 14,  7,  7, 14,  6, 21, 15, 15,
+   15, 15,  9, 13,  8, 15, 13, 19, 13, 13, 12,  9,  7,  9, 12 };
+
+const GFXmetrics FreeSansBold12pt7bMetrics PROGMEM = {
+  17, 5, 0, 0, (uint8_t *)FreeSansBold12pt7bAdvances };
+
 const GFXfont FreeSansBold12pt7b PROGMEM = {
   (uint8_t  *)FreeSansBold12pt7bBitmaps,
   (GFXglyph *)FreeSansBold12pt7bGlyphs,
-  0x20, 0x7E, 29 };
+  0x20, 0x7E, 29,
+  (GFXmetrics *)&FreeSansBold12pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 2858 bytes
+// Approx. 2967 bytes
@@ -473,9 +473,24 @@ const GFXglyph FreeSansBold18pt7bGlyphs[] PROGMEM = {
   {  4453,   9,  33,  14,    3,  -25 },   // 0x7D '}'
   {  4491,  15,   6,  18,    1,  -10 } }; // 0x7E '~'
 
+const uint8_t FreeSansBold18pt7bAdvances[] PROGMEM = {
+   10, 12, 17, 19, 19, 31, 25,  9, 12, 12, 14, 20,  9, 12,  9, 10,
+   19, 19, 19, 19, 19, 19, 19, 19, 19, 19,  9,  9, 20, 20, 20, 21,
+   34, 24, 25, 25, 25, 23, 22, 27, 26, 11, 20, 25, 22, 30, 26, 27,
+   24, 27, 25, 24, 23, 26, 23, 34, 24, 22, 21, 12, 10, 12, 20, 19,
+    9, 20, 22, 20, 22, 20, 12, 21, 21, 10, 10, 20,  9, 31, 21, 21,
+   22, 22, 14, 19, 12, 21, 19, 27, 19, 19, 18, 14, 10, 14, 18 };
+
+const GFXmetrics FreeSansBold18pt7bMetrics PROGMEM = {
+  25, 7, 0, 0, (uint8_t *)FreeSansBold18pt7bAdvances };
+
 const GFXfont FreeSansBold18pt7b PROGMEM = {
   (uint8_t  *)FreeSansBold18pt7bBitmaps,
   (GFXglyph *)FreeSansBold18pt7bGlyphs,
-  0x20, 0x7E, 42 };
+  0x20, 0x7E, 42,
+  (GFXmetrics *)&FreeSansBold18pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 5175 bytes
+// Approx. 5284 bytes
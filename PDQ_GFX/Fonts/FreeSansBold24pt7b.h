@@ -776,9 +776,24 @@ const GFXglyph FreeSansBold24pt7bGlyphs[] PROGMEM = {
   {  8052,  13,  43,  18,    3,  -33 },   // 0x7D '}'
   {  8122,  21,   8,  23,    1,  -14 } }; // 0x7E '~'
 
+const uint8_t FreeSansBold24pt7bAdvances[] PROGMEM = {
+   13, 16, 22, 26, 26, 42, 34, 12, 16, 16, 18, 27, 12, 16, 12, 13,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 12, 12, 27, 27, 27, 29,
+   46, 33, 33, 34, 34, 31, 30, 36, 35, 15, 27, 34, 29, 41, 35, 37,
+   32, 37, 34, 32, 30, 35, 31, 45, 32, 30, 29, 16, 13, 16, 27, 26,
+   12, 27, 29, 26, 29, 27, 16, 29, 28, 13, 13, 27, 13, 42, 29, 29,
+   29, 29, 18, 26, 16, 29, 25, 37, 26, 26, 24, 18, 13, 18, 23 };
+
+const GFXmetrics FreeSansBold24pt7bMetrics PROGMEM = {
+  35, 11, 0, 0, (uint8_t *)FreeSansBold24pt7bAdvances };
+
 const GFXfont FreeSansBold24pt7b PROGMEM = {
   (uint8_t  *)FreeSansBold24pt7bBitmaps,
   (GFXglyph *)FreeSansBold24pt7bGlyphs,
-  0x20, 0x7E, 56 };
+  0x20, 0x7E, 56,
+  (GFXmetrics *)&FreeSansBold24pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 8815 bytes
+// Approx. 8924 bytes
@@ -200,9 +200,24 @@ const GFXglyph FreeSansBold9pt7bGlyphs[] PROGMEM = {
   {  1219,   4,  17,   7,    2,  -12 },   // 0x7D '}'
   {  1228,   8,   2,   9,    0,   -4 } }; // 0x7E '~'
 
+const uint8_t FreeSansBold9pt7bAdvances[] PROGMEM = {
+    5,  6,  9, 10, 10, 16, 13,  5,  6,  6,  7, 11,  4,  6,  4,  5,
+   10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  4,  4, 11, 11, 11, 11,
+   18, 13, 13, 13, 13, 12, 11, 14, 13,  6, 10, 13, 11, 16, 14, 14,
+   12, 14, 13, 12, 12, 13, 12, 17, 12, 12, 11,  6,  5,  6, 11, 10,
+    5, 10, 11, 10, 11, 10,  6, 11, 11,  5,  5, 10,  5, 16, 11, 11,
+   11, 11,  7, 10,  6, 11, 10, 14, 10, 10,  9,  7,  5,  7,  9 };
+
+const GFXmetrics FreeSansBold9pt7bMetrics PROGMEM = {
+  13, 4, 0, 0, (uint8_t *)FreeSansBold9pt7bAdvances };
+
 const GFXfont FreeSansBold9pt7b PROGMEM = {
   (uint8_t  *)FreeSansBold9pt7bBitmaps,
   (GFXglyph *)FreeSansBold9pt7bGlyphs,
-  0x20, 0x7E, 22 };
+  0x20, 0x7E, 22,
+  (GFXmetrics *)&FreeSansBold9pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 1902 bytes
+// Approx. 2011 bytes
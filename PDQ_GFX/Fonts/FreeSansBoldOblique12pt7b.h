@@ -309,9 +309,24 @@ const GFXglyph FreeSansBoldOblique12pt7bGlyphs[] PROGMEM = {
   {  2501,   9,  23,   9,    0,  -17 },   // 0x7D '}'
   {  2527,  12,   5,  14,    2,   -7 } }; // 0x7E '~'
 
+const uint8_t FreeSansBoldOblique12pt7bAdvances[] PROGMEM = {
+    7,  8, 11, 13, 13, 21, 17,  6,  8,  8,  9, 14,  7,  8,  7,  7,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  8,  8, 14, 14, 14, 15,
+   23, 17, 17, 17, 17, 16, 15, 19, 17,  7, 13, 17, 15, 20, 17, 19,
+   16, 19, 17, 16, 15, 17, 16, 23, 16, 16, 15,  8,  7,  8, 14, 13,
+    8, 13, 15, 13, 15, 13,  8, 15, 15,  7,  7, 13,  7, 21, 15, 15,
+   15, 15,  9, 13,  8, 15, 13, 19, 13, 13, 12,  9,  7,  9, 14 };
+
+const GFXmetrics FreeSansBoldOblique12pt7bMetrics PROGMEM = {
+  22, 5, 0, 0, (uint8_t *)FreeSansBoldOblique12pt7bAdvances };
+
 const GFXfont FreeSansBoldOblique12pt7b PROGMEM = {
   (uint8_t  *)FreeSansBoldOblique12pt7bBitmaps,
   (GFXglyph *)FreeSansBoldOblique12pt7bGlyphs,
-  0x20, 0x7E, 29 };
+  0x20, 0x7E, 29,
+  (GFXmetrics *)&FreeSansBoldOblique12pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 3207 bytes
+// Approx. 3316 bytes
@@ -537,9 +537,24 @@ const GFXglyph FreeSansBoldOblique18pt7bGlyphs[] PROGMEM = {
   {  5200,  14,  33,  14,    2,  -25 },   // 0x7D '}'
   {  5258,  17,   6,  20,    3,  -10 } }; // 0x7E '~'
 
+const uint8_t FreeSansBoldOblique18pt7bAdvances[] PROGMEM = {
+   10, 12, 17, 19, 19, 31, 25,  8, 12, 12, 14, 20, 10, 12, 10, 10,
+   19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 12, 12, 20, 20, 20, 21,
+   34, 25, 25, 25, 25, 23, 21, 27, 25, 10, 19, 25, 21, 29, 25, 27,
+   23, 27, 25, 23, 21, 25, 23, 33, 23, 23, 21, 12, 10, 12, 20, 19,
+   12, 19, 21, 19, 21, 19, 12, 21, 21, 10, 10, 19, 10, 31, 21, 21,
+   21, 21, 14, 19, 12, 21, 19, 27, 19, 19, 17, 14, 10, 14, 20 };
+
+const GFXmetrics FreeSansBoldOblique18pt7bMetrics PROGMEM = {
+  26, 8, 0, 0, (uint8_t *)FreeSansBoldOblique18pt7bAdvances };
+
 const GFXfont FreeSansBoldOblique18pt7b PROGMEM = {
   (uint8_t  *)FreeSansBoldOblique18pt7bBitmaps,
   (GFXglyph *)FreeSansBoldOblique18pt7bGlyphs,
-  0x20, 0x7E, 42 };
+  0x20, 0x7E, 42,
+  (GFXmetrics *)&FreeSansBoldOblique18pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 5943 bytes
+// Approx. 6052 bytes
@@ -885,9 +885,24 @@ const GFXglyph FreeSansBoldOblique24pt7bGlyphs[] PROGMEM = {
   {  9328,  18,  43,  18,    2,  -33 },   // 0x7D '}'
   {  9425,  22,   8,  27,    5,  -14 } }; // 0x7E '~'
 
+const uint8_t FreeSansBoldOblique24pt7bAdvances[] PROGMEM = {
+   13, 16, 22, 26, 26, 42, 34, 11, 16, 16, 18, 27, 13, 16, 13, 13,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 27, 27, 27, 29,
+   46, 34, 34, 34, 34, 31, 29, 37, 34, 13, 26, 34, 29, 39, 34, 37,
+   31, 37, 34, 31, 29, 34, 31, 44, 31, 31, 29, 16, 13, 16, 27, 26,
+   16, 26, 29, 26, 29, 26, 16, 29, 29, 13, 13, 26, 13, 42, 29, 29,
+   29, 29, 18, 26, 16, 29, 26, 37, 26, 26, 23, 18, 13, 18, 27 };
+
+const GFXmetrics FreeSansBoldOblique24pt7bMetrics PROGMEM = {
+  35, 10, 0, 0, (uint8_t *)FreeSansBoldOblique24pt7bAdvances };
+
 const GFXfont FreeSansBoldOblique24pt7b PROGMEM = {
   (uint8_t  *)FreeSansBoldOblique24pt7bBitmaps,
   (GFXglyph *)FreeSansBoldOblique24pt7bGlyphs,
-  0x20, 0x7E, 56 };
+  0x20, 0x7E, 56,
+  (GFXmetrics *)&FreeSansBoldOblique24pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 10119 bytes
+// Approx. 10228 bytes
@@ -219,9 +219,24 @@ const GFXglyph FreeSansBoldOblique9pt7bGlyphs[] PROGMEM = {
   {  1447,   7,  17,   7,    0,  -13 },   // 0x7D '}'
   {  1462,   8,   2,  11,    2,   -4 } }; // 0x7E '~'
 
+const uint8_t FreeSansBoldOblique9pt7bAdvances[] PROGMEM = {
+    5,  6,  9, 10, 10, 16, 13,  4,  6,  6,  7, 11,  5,  6,  5,  5,
+   10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  6,  6, 11, 11, 11, 11,
+   18, 13, 13, 13, 13, 12, 11, 14, 13,  5, 10, 13, 11, 15, 13, 14,
+   12, 14, 13, 12, 11, 13, 12, 17, 12, 12, 11,  6,  5,  6, 11, 10,
+    6, 10, 11, 10, 11, 10,  6, 11, 11,  5,  5, 10,  5, 16, 11, 11,
+   11, 11,  7, 10,  6, 11, 10, 14, 10, 10,  9,  7,  5,  7, 11 };
+
+const GFXmetrics FreeSansBoldOblique9pt7bMetrics PROGMEM = {
+  16, 4, 0, 0, (uint8_t *)FreeSansBoldOblique9pt7bAdvances };
+
 const GFXfont FreeSansBoldOblique9pt7b PROGMEM = {
   (uint8_t  *)FreeSansBoldOblique9pt7bBitmaps,
   (GFXglyph *)FreeSansBoldOblique9pt7bGlyphs,
-  0x20, 0x7E, 22 };
+  0x20, 0x7E, 22,
+  (GFXmetrics *)&FreeSansBoldOblique9pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 2136 bytes
+// Approx. 2245 bytes
@@ -294,9 +294,24 @@ const GFXglyph FreeSansOblique12pt7bGlyphs[] PROGMEM = {
   {  2329,   9,  23,   8,   -1,  -16 },   // 0x7D '}'
   {  2355,  11,   5,  14,    3,  -10 } }; // 0x7E '~'
 
+const uint8_t FreeSansOblique12pt7bAdvances[] PROGMEM = {
+    7,  7,  9, 13, 13, 21, 16,  5,  8,  8,  9, 14,  7,  8,  7,  7,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  7,  7, 14, 14, 14, 13,
+   24, 16, 16, 17, 17, 16, 14, 19, 17,  7, 12, 16, 13, 20, 18, 18,
+   15, 19, 17, 16, 15, 17, 15, 22, 16, 16, 15,  7,  7,  7, 11, 13,
+    8, 13, 13, 12, 13, 13,  6, 13, 13,  5,  6, 12,  5, 20, 13, 13,
+   14, 13,  8, 12,  6, 13, 12, 17, 12, 11, 12,  8,  6,  8, 14 };
+
+const GFXmetrics FreeSansOblique12pt7bMetrics PROGMEM = {
+  17, 6, 0, 0, (uint8_t *)FreeSansOblique12pt7bAdvances };
+
 const GFXfont FreeSansOblique12pt7b PROGMEM = {
   (uint8_t  *)FreeSansOblique12pt7bBitmaps,
   (GFXglyph *)FreeSansOblique12pt7bGlyphs,
-  0x20, 0x7E, 29 };
+  0x20, 0x7E, 29,
+  (GFXmetrics *)&FreeSansOblique12pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 3034 bytes
+// Approx. 3143 bytes
@@ -510,9 +510,24 @@ const GFXglyph FreeSansOblique18pt7bGlyphs[] PROGMEM = {
   {  4887,  12,  33,  12,    0,  -24 },   // 0x7D '}'
   {  4937,  16,   7,  20,    5,  -15 } }; // 0x7E '~'
 
+const uint8_t FreeSansOblique18pt7bAdvances[] PROGMEM = {
+   10, 10, 12, 19, 19, 31, 23,  7, 12, 12, 14, 20, 10, 12, 10, 10,
+   19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 10, 10, 20, 20, 20, 19,
+   36, 23, 23, 25, 25, 23, 21, 27, 25, 10, 18, 23, 19, 30, 26, 27,
+   23, 27, 25, 23, 21, 25, 23, 33, 23, 24, 21, 10, 10, 10, 16, 19,
+   12, 19, 20, 18, 20, 19,  9, 19, 19,  8,  8, 18,  8, 29, 19, 19,
+   20, 19, 11, 18,  9, 19, 17, 25, 17, 17, 17, 12,  9, 12, 20 };
+
+const GFXmetrics FreeSansOblique18pt7bMetrics PROGMEM = {
+  26, 8, 0, 0, (uint8_t *)FreeSansOblique18pt7bAdvances };
+
 const GFXfont FreeSansOblique18pt7b PROGMEM = {
   (uint8_t  *)FreeSansOblique18pt7bBitmaps,
   (GFXglyph *)FreeSansOblique18pt7bGlyphs,
-  0x20, 0x7E, 42 };
+  0x20, 0x7E, 42,
+  (GFXmetrics *)&FreeSansOblique18pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 5623 bytes
+// Approx. 5732 bytes
@@ -832,9 +832,24 @@ const GFXglyph FreeSansOblique24pt7bGlyphs[] PROGMEM = {
   {  8704,  16,  44,  16,   -1,  -33 },   // 0x7D '}'
   {  8792,  21,   7,  27,    6,  -19 } }; // 0x7E '~'
 
+const uint8_t FreeSansOblique24pt7bAdvances[] PROGMEM = {
+   13, 13, 17, 26, 26, 42, 31,  9, 16, 16, 18, 27, 13, 16, 13, 13,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 13, 13, 27, 27, 27, 26,
+   48, 31, 31, 33, 33, 31, 28, 37, 34, 13, 24, 31, 26, 40, 34, 36,
+   30, 36, 33, 31, 29, 34, 30, 44, 31, 32, 29, 13, 13, 13, 22, 26,
+   16, 26, 26, 24, 26, 26, 12, 26, 25, 10, 11, 24, 10, 38, 25, 26,
+   26, 26, 15, 24, 12, 25, 23, 34, 23, 23, 23, 16, 12, 16, 27 };
+
+const GFXmetrics FreeSansOblique24pt7bMetrics PROGMEM = {
+  35, 10, 0, 0, (uint8_t *)FreeSansOblique24pt7bAdvances };
+
 const GFXfont FreeSansOblique24pt7b PROGMEM = {
   (uint8_t  *)FreeSansOblique24pt7bBitmaps,
   (GFXglyph *)FreeSansOblique24pt7bGlyphs,
-  0x20, 0x7E, 56 };
+  0x20, 0x7E, 56,
+  (GFXmetrics *)&FreeSansOblique24pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 9483 bytes
+// Approx. 9592 bytes
@@ -251,9 +251,24 @@ const GFXglyph FreeSerif12pt7bGlyphs[] PROGMEM = {
   {  1820,   5,  21,  12,    5,  -15 },   // 0x7D '}'
   {  1834,  12,   3,  12,    0,   -6 } }; // 0x7E '~'
 
+const uint8_t FreeSerif12pt7bAdvances[] PROGMEM = {
+    6,  8, 10, 12, 12, 20, 19,  5,  8,  8, 12, 14,  6,  8,  6,  7,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  6,  6, 14, 14, 14, 11,
+   21, 17, 15, 16, 17, 15, 14, 17, 17,  8,  9, 17, 15, 21, 17, 17,
+   14, 17, 16, 13, 15, 17, 17, 23, 17, 17, 15,  8,  7,  8, 11, 12,
+    6, 10, 12, 11, 12, 11,  9, 11, 12,  7,  8, 12,  6, 19, 12, 12,
+   12, 12,  8,  9,  7, 12, 11, 16, 12, 11, 10, 12,  5, 12, 12 };
+
+const GFXmetrics FreeSerif12pt7bMetrics PROGMEM = {
+  16, 5, 0, 0, (uint8_t *)FreeSerif12pt7bAdvances };
+
 const GFXfont FreeSerif12pt7b PROGMEM = {
   (uint8_t  *)FreeSerif12pt7bBitmaps,
   (GFXglyph *)FreeSerif12pt7bGlyphs,
-  0x20, 0x7E, 29 };
+  0x20, 0x7E, 29,
+  (GFXmetrics *)&FreeSerif12pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 2511 bytes
+// Approx. 2620 bytes
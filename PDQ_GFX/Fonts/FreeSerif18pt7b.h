@@ -421,9 +421,24 @@ const GFXglyph FreeSerif18pt7bGlyphs[] PROGMEM = {
   {  3848,   8,  30,  17,    6,  -22 },   // 0x7D '}'
   {  3878,  16,   4,  17,    1,  -10 } }; // 0x7E '~'
 
+const uint8_t FreeSerif18pt7bAdvances[] PROGMEM = {
+    9, 12, 14, 17, 17, 29, 27,  7, 12, 12, 18, 20,  9, 12,  9, 10,
+   18, 18, 17, 17, 18, 17, 18, 18, 18, 17,  9,  9, 20, 20, 20, 16,
+   30, 25, 22, 23, 25, 21, 20, 25, 25, 11, 13, 25, 21, 31, 25, 25,
+   20, 25, 23, 19, 21, 25, 25, 33, 25, 25, 21, 12, 10, 12, 16, 17,
+    9, 15, 17, 16, 17, 16, 13, 16, 17, 10, 12, 18,  9, 27, 17, 17,
+   17, 17, 12, 13, 10, 17, 16, 24, 17, 16, 15, 17,  7, 17, 17 };
+
+const GFXmetrics FreeSerif18pt7bMetrics PROGMEM = {
+  24, 8, 0, 0, (uint8_t *)FreeSerif18pt7bAdvances };
+
 const GFXfont FreeSerif18pt7b PROGMEM = {
   (uint8_t  *)FreeSerif18pt7bBitmaps,
   (GFXglyph *)FreeSerif18pt7bGlyphs,
-  0x20, 0x7E, 42 };
+  0x20, 0x7E, 42,
+  (GFXmetrics *)&FreeSerif18pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 4558 bytes
+// Approx. 4667 bytes
@@ -682,9 +682,24 @@ const GFXglyph FreeSerif24pt7bGlyphs[] PROGMEM = {
   {  6939,  11,  41,  23,    7,  -31 },   // 0x7D '}'
   {  6996,  22,   5,  23,    1,  -13 } }; // 0x7E '~'
 
+const uint8_t FreeSerif24pt7bAdvances[] PROGMEM = {
+   12, 16, 19, 23, 24, 39, 37,  9, 16, 16, 24, 27, 12, 16, 12, 14,
+   23, 24, 23, 23, 24, 24, 23, 24, 23, 24, 12, 12, 27, 27, 27, 21,
+   41, 34, 30, 31, 34, 29, 27, 35, 34, 15, 18, 33, 29, 41, 34, 34,
+   27, 34, 31, 25, 28, 34, 33, 45, 34, 33, 29, 16, 14, 16, 22, 23,
+   12, 20, 24, 21, 23, 21, 18, 22, 23, 13, 16, 24, 12, 37, 23, 23,
+   24, 23, 16, 17, 13, 23, 22, 32, 23, 22, 20, 23,  9, 23, 23 };
+
+const GFXmetrics FreeSerif24pt7bMetrics PROGMEM = {
+  33, 10, 0, 0, (uint8_t *)FreeSerif24pt7bAdvances };
+
 const GFXfont FreeSerif24pt7b PROGMEM = {
   (uint8_t  *)FreeSerif24pt7bBitmaps,
   (GFXglyph *)FreeSerif24pt7bGlyphs,
-  0x20, 0x7E, 56 };
+  0x20, 0x7E, 56,
+  (GFXmetrics *)&FreeSerif24pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 7682 bytes
+// Approx. 7791 bytes
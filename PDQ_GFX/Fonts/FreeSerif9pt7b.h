@@ -187,9 +187,24 @@ const GFXglyph FreeSerif9pt7bGlyphs[] PROGMEM = {
   {  1066,   5,  16,   9,    3,  -11 },   // 0x7D '}'
   {  1076,   9,   3,   9,    0,   -5 } }; // 0x7E '~'
 
+const uint8_t FreeSerif9pt7bAdvances[] PROGMEM = {
+    5,  6,  7,  9,  9, 15, 14,  4,  6,  6,  9, 10,  4,  6,  5,  5,
+    9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  5,  5, 10, 10, 10,  8,
+   16, 13, 11, 12, 13, 11, 10, 13, 13,  6,  7, 13, 11, 16, 13, 13,
+   10, 13, 12, 10, 11, 13, 13, 17, 13, 13, 11,  6,  5,  6,  8,  9,
+    5,  8,  9,  8,  9,  8,  7,  8,  9,  5,  6,  9,  5, 14,  9,  9,
+    9,  9,  6,  7,  5,  9,  8, 12,  9,  8,  7,  9,  4,  9,  9 };
+
+const GFXmetrics FreeSerif9pt7bMetrics PROGMEM = {
+  12, 4, 0, 0, (uint8_t *)FreeSerif9pt7bAdvances };
+
 const GFXfont FreeSerif9pt7b PROGMEM = {
   (uint8_t  *)FreeSerif9pt7bBitmaps,
   (GFXglyph *)FreeSerif9pt7bGlyphs,
-  0x20, 0x7E, 22 };
+  0x20, 0x7E, 22,
+  (GFXmetrics *)&FreeSerif9pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 1752 bytes
+// Approx. 1861 bytes
@@ -263,9 +263,24 @@ const GFXglyph FreeSerifBold12pt7bGlyphs[] PROGMEM = {
   {  1964,   8,  21,   9,    2,  -16 },   // 0x7D '}'
   {  1985,  11,   4,  12,    1,   -7 } }; // 0x7E '~'
 
+const uint8_t FreeSerifBold12pt7bAdvances[] PROGMEM = {
+    6,  8, 13, 12, 12, 24, 20,  7,  8,  8, 12, 16,  6,  8,  6,  7,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  8,  8, 16, 16, 16, 12,
+   22, 17, 16, 17, 18, 16, 15, 19, 19,  9, 12, 19, 16, 23, 17, 19,
+   15, 19, 17, 14, 15, 17, 17, 24, 17, 17, 16,  8,  7,  8, 14, 12,
+    8, 12, 13, 10, 13, 11,  9, 12, 13,  7, 10, 13,  7, 20, 13, 12,
+   13, 13, 10, 10,  8, 14, 12, 17, 12, 12, 11,  9,  5,  9, 12 };
+
+const GFXmetrics FreeSerifBold12pt7bMetrics PROGMEM = {
+  17, 5, 0, 0, (uint8_t *)FreeSerifBold12pt7bAdvances };
+
 const GFXfont FreeSerifBold12pt7b PROGMEM = {
   (uint8_t  *)FreeSerifBold12pt7bBitmaps,
   (GFXglyph *)FreeSerifBold12pt7bGlyphs,
-  0x20, 0x7E, 29 };
+  0x20, 0x7E, 29,
+  (GFXmetrics *)&FreeSerifBold12pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 2663 bytes
+// Approx. 2772 bytes
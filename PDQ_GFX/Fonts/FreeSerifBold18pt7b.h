@@ -454,9 +454,24 @@ const GFXglyph FreeSerifBold18pt7bGlyphs[] PROGMEM = {
   {  4220,  11,  31,  14,    3,  -24 },   // 0x7D '}'
   {  4263,  16,   5,  18,    1,  -11 } }; // 0x7E '~'
 
+const uint8_t FreeSerifBold18pt7bAdvances[] PROGMEM = {
+    9, 12, 19, 17, 17, 35, 29, 10, 12, 12, 18, 24,  9, 12,  9, 10,
+   18, 18, 17, 18, 18, 18, 18, 17, 17, 18, 12, 12, 24, 24, 24, 18,
+   33, 25, 23, 25, 26, 23, 22, 27, 27, 14, 18, 27, 23, 33, 25, 27,
+   22, 27, 25, 20, 23, 25, 25, 34, 25, 25, 23, 12, 10, 12, 20, 17,
+   12, 18, 19, 15, 19, 16, 14, 17, 19, 10, 14, 19, 10, 29, 19, 18,
+   19, 19, 15, 14, 12, 20, 17, 25, 18, 17, 16, 14,  8, 14, 18 };
+
+const GFXmetrics FreeSerifBold18pt7bMetrics PROGMEM = {
+  25, 7, 0, 0, (uint8_t *)FreeSerifBold18pt7bAdvances };
+
 const GFXfont FreeSerifBold18pt7b PROGMEM = {
   (uint8_t  *)FreeSerifBold18pt7bBitmaps,
   (GFXglyph *)FreeSerifBold18pt7bGlyphs,
-  0x20, 0x7E, 42 };
+  0x20, 0x7E, 42,
+  (GFXmetrics *)&FreeSerifBold18pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 4945 bytes
+// Approx. 5054 bytes
@@ -751,9 +751,24 @@ const GFXglyph FreeSerifBold24pt7bGlyphs[] PROGMEM = {
   {  7753,  14,  42,  19,    4,  -33 },   // 0x7D '}'
   {  7827,  22,   7,  24,    1,  -14 } }; // 0x7E '~'
 
+const uint8_t FreeSerifBold24pt7bAdvances[] PROGMEM = {
+   12, 16, 26, 23, 24, 47, 39, 13, 16, 16, 24, 32, 12, 16, 12, 13,
+   23, 23, 24, 24, 24, 23, 24, 23, 23, 23, 16, 16, 32, 32, 32, 24,
+   44, 34, 31, 33, 34, 32, 29, 36, 37, 18, 24, 36, 31, 45, 34, 37,
+   30, 37, 34, 27, 30, 34, 33, 46, 34, 33, 30, 16, 13, 16, 27, 23,
+   16, 23, 26, 20, 26, 21, 18, 24, 26, 14, 18, 26, 13, 39, 26, 24,
+   26, 26, 20, 19, 16, 27, 23, 33, 24, 23, 21, 19, 10, 19, 24 };
+
+const GFXmetrics FreeSerifBold24pt7bMetrics PROGMEM = {
+  34, 9, 0, 0, (uint8_t *)FreeSerifBold24pt7bAdvances };
+
 const GFXfont FreeSerifBold24pt7b PROGMEM = {
   (uint8_t  *)FreeSerifBold24pt7bBitmaps,
   (GFXglyph *)FreeSerifBold24pt7bGlyphs,
-  0x20, 0x7E, 56 };
+  0x20, 0x7E, 56,
+  (GFXmetrics *)&FreeSerifBold24pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 8519 bytes
+// Approx. 8628 bytes
@@ -194,9 +194,24 @@ const GFXglyph FreeSerifBold9pt7bGlyphs[] PROGMEM = {
   {  1150,   5,  16,   7,    2,  -12 },   // 0x7D '}'
   {  1160,   8,   2,   9,    1,   -4 } }; // 0x7E '~'
 
+const uint8_t FreeSerifBold9pt7bAdvances[] PROGMEM = {
+    5,  6, 10,  9,  9, 18, 15,  5,  6,  6,  9, 12,  4,  6,  4,  5,
+    9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  6,  6, 12, 12, 12,  9,
+   17, 13, 12, 13, 13, 12, 11, 14, 14,  7,  9, 14, 12, 17, 13, 14,
+   11, 14, 13, 10, 12, 13, 13, 18, 13, 13, 12,  6,  5,  6, 10,  9,
+    6,  9, 10,  8, 10,  8,  7,  9, 10,  5,  7, 10,  5, 15, 10,  9,
+   10, 10,  8,  7,  6, 10,  9, 13,  9,  9,  8,  7,  4,  7,  9 };
+
+const GFXmetrics FreeSerifBold9pt7bMetrics PROGMEM = {
+  12, 4, 0, 0, (uint8_t *)FreeSerifBold9pt7bAdvances };
+
 const GFXfont FreeSerifBold9pt7b PROGMEM = {
   (uint8_t  *)FreeSerifBold9pt7bBitmaps,
   (GFXglyph *)FreeSerifBold9pt7bGlyphs,
-  0x20, 0x7E, 22 };
+  0x20, 0x7E, 22,
+  (GFXmetrics *)&FreeSerifBold9pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 1834 bytes
+// Approx. 1943 bytes
@@ -284,9 +284,24 @@ const GFXglyph FreeSerifBoldItalic12pt7bGlyphs[] PROGMEM = {
   {  2205,  10,  21,   8,   -3,  -16 },   // 0x7D '}'
   {  2232,  11,   4,  14,    1,   -7 } }; // 0x7E '~'
 
+const uint8_t FreeSerifBoldItalic12pt7bAdvances[] PROGMEM = {
+    6,  9, 13, 12, 12, 20, 19,  7,  8,  8, 12, 14,  6,  8,  6,  8,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  6,  6, 14, 14, 14, 12,
+   20, 17, 15, 15, 17, 15, 15, 17, 18,  9, 12, 16, 15, 21, 17, 16,
+   14, 16, 16, 12, 14, 17, 17, 22, 17, 15, 13,  8, 10,  8, 14, 12,
+    8, 12, 12, 10, 12, 10, 12, 12, 13,  7,  8, 12,  7, 18, 13, 11,
+   12, 12, 10,  9,  7, 13, 11, 16, 11, 10, 10,  8,  6,  8, 14 };
+
+const GFXmetrics FreeSerifBoldItalic12pt7bMetrics PROGMEM = {
+  17, 5, 0, 0, (uint8_t *)FreeSerifBoldItalic12pt7bAdvances };
+
 const GFXfont FreeSerifBoldItalic12pt7b PROGMEM = {
   (uint8_t  *)FreeSerifBoldItalic12pt7bBitmaps,
   (GFXglyph *)FreeSerifBoldItalic12pt7bGlyphs,
-  0x20, 0x7E, 29 };
+  0x20, 0x7E, 29,
+  (GFXmetrics *)&FreeSerifBoldItalic12pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 2910 bytes
+// Approx. 3019 bytes
@@ -492,9 +492,24 @@ const GFXglyph FreeSerifBoldItalic18pt7bGlyphs[] PROGMEM = {
   {  4668,  15,  32,  12,   -5,  -24 },   // 0x7D '}'
   {  4728,  16,   5,  20,    2,  -11 } }; // 0x7E '~'
 
+const uint8_t FreeSerifBoldItalic18pt7bAdvances[] PROGMEM = {
+    9, 14, 19, 17, 18, 29, 27, 10, 12, 12, 18, 20,  9, 12,  9, 12,
+   18, 17, 18, 17, 17, 18, 18, 17, 18, 18,  9,  9, 20, 20, 20, 17,
+   29, 24, 22, 22, 25, 22, 21, 25, 26, 13, 17, 23, 21, 31, 25, 24,
+   21, 24, 23, 18, 21, 25, 25, 32, 24, 22, 20, 12, 14, 12, 20, 17,
+   12, 18, 17, 15, 18, 15, 17, 17, 19, 10, 12, 18, 10, 27, 18, 17,
+   17, 17, 14, 12, 10, 19, 15, 23, 17, 15, 14, 12,  9, 12, 20 };
+
+const GFXmetrics FreeSerifBoldItalic18pt7bMetrics PROGMEM = {
+  25, 7, 0, 0, (uint8_t *)FreeSerifBoldItalic18pt7bAdvances };
+
 const GFXfont FreeSerifBoldItalic18pt7b PROGMEM = {
   (uint8_t  *)FreeSerifBoldItalic18pt7bBitmaps,
   (GFXglyph *)FreeSerifBoldItalic18pt7bGlyphs,
-  0x20, 0x7E, 42 };
+  0x20, 0x7E, 42,
+  (GFXmetrics *)&FreeSerifBoldItalic18pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 5410 bytes
+// Approx. 5519 bytes
@@ -785,9 +785,24 @@ const GFXglyph FreeSerifBoldItalic24pt7bGlyphs[] PROGMEM = {
   {  8123,  20,  41,  16,   -6,  -31 },   // 0x7D '}'
   {  8226,  21,   7,  27,    3,  -14 } }; // 0x7E '~'
 
+const uint8_t FreeSerifBoldItalic24pt7bAdvances[] PROGMEM = {
+   12, 18, 26, 23, 24, 39, 37, 13, 16, 16, 23, 27, 12, 16, 12, 16,
+   23, 23, 23, 24, 23, 24, 24, 23, 23, 23, 12, 12, 27, 27, 27, 24,
+   39, 33, 30, 29, 34, 30, 29, 33, 35, 18, 23, 31, 29, 41, 33, 32,
+   28, 32, 31, 24, 28, 34, 33, 44, 33, 30, 26, 16, 19, 16, 27, 23,
+   16, 24, 23, 20, 24, 20, 23, 23, 26, 14, 16, 24, 14, 36, 25, 22,
+   23, 23, 19, 17, 13, 25, 21, 31, 22, 20, 19, 16, 13, 16, 27 };
+
+const GFXmetrics FreeSerifBoldItalic24pt7bMetrics PROGMEM = {
+  33, 10, 0, 0, (uint8_t *)FreeSerifBoldItalic24pt7bAdvances };
+
 const GFXfont FreeSerifBoldItalic24pt7b PROGMEM = {
   (uint8_t  *)FreeSerifBoldItalic24pt7bBitmaps,
   (GFXglyph *)FreeSerifBoldItalic24pt7bGlyphs,
-  0x20, 0x7E, 56 };
+  0x20, 0x7E, 56,
+  (GFXmetrics *)&FreeSerifBoldItalic24pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 8917 bytes
+// Approx. 9026 bytes
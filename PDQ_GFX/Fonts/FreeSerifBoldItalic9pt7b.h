@@ -207,9 +207,24 @@ const GFXglyph FreeSerifBoldItalic9pt7bGlyphs[] PROGMEM = {
   {  1292,   8,  16,   6,   -2,  -12 },   // 0x7D '}'
   {  1308,   8,   2,  10,    1,   -4 } }; // 0x7E '~'
 
+const uint8_t FreeSerifBoldItalic9pt7bAdvances[] PROGMEM = {
+    5,  7, 10,  9,  9, 15, 14,  5,  6,  6,  9, 10,  5,  6,  4,  6,
+    9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  5,  5, 10, 10, 10,  9,
+   15, 13, 12, 11, 13, 11, 11, 13, 14,  7,  9, 12, 11, 16, 13, 12,
+   11, 12, 12,  9, 11, 13, 13, 17, 13, 11, 10,  6,  7,  6, 10,  9,
+    6,  9,  9,  8,  9,  7,  9,  9, 10,  5,  6,  9,  5, 14,  9,  9,
+    9,  9,  7,  6,  5, 10,  8, 12,  9,  8,  7,  6,  5,  6, 10 };
+
+const GFXmetrics FreeSerifBoldItalic9pt7bMetrics PROGMEM = {
+  12, 4, 0, 0, (uint8_t *)FreeSerifBoldItalic9pt7bAdvances };
+
 const GFXfont FreeSerifBoldItalic9pt7b PROGMEM = {
   (uint8_t  *)FreeSerifBoldItalic9pt7bBitmaps,
   (GFXglyph *)FreeSerifBoldItalic9pt7bGlyphs,
-  0x20, 0x7E, 22 };
+  0x20, 0x7E, 22,
+  (GFXmetrics *)&FreeSerifBoldItalic9pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 1982 bytes
+// Approx. 2091 bytes
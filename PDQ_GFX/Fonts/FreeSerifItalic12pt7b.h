@@ -263,9 +263,24 @@ const GFXglyph FreeSerifItalic12pt7bGlyphs[] PROGMEM = {
   {  1955,   9,  21,  10,    0,  -16 },   // 0x7D '}'
   {  1979,  11,   3,  13,    1,   -6 } }; // 0x7E '~'
 
+const uint8_t FreeSerifItalic12pt7bAdvances[] PROGMEM = {
+    6,  8,  8, 12, 12, 20, 19,  5,  8,  8, 12, 16,  6,  8,  6,  7,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  6,  6, 14, 16, 14, 11,
+   19, 16, 14, 15, 17, 14, 14, 17, 17,  8, 10, 15, 14, 20, 16, 16,
+   14, 16, 15, 11, 14, 17, 16, 21, 16, 14, 14,  9, 12,  9, 10, 12,
+    6, 12, 11, 10, 12, 10, 10, 11, 12,  6,  7, 11,  6, 17, 12, 11,
+   11, 12,  9,  8,  6, 12, 11, 16, 10, 11,  9, 10,  7, 10, 13 };
+
+const GFXmetrics FreeSerifItalic12pt7bMetrics PROGMEM = {
+  17, 5, 0, 0, (uint8_t *)FreeSerifItalic12pt7bAdvances };
+
 const GFXfont FreeSerifItalic12pt7b PROGMEM = {
   (uint8_t  *)FreeSerifItalic12pt7bBitmaps,
   (GFXglyph *)FreeSerifItalic12pt7bGlyphs,
-  0x20, 0x7E, 29 };
+  0x20, 0x7E, 29,
+  (GFXmetrics *)&FreeSerifItalic12pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 2656 bytes
+// Approx. 2765 bytes
@@ -442,9 +442,24 @@ const GFXglyph FreeSerifItalic18pt7bGlyphs[] PROGMEM = {
   {  4077,  12,  31,  14,    0,  -24 },   // 0x7D '}'
   {  4124,  17,   4,  19,    1,  -10 } }; // 0x7E '~'
 
+const uint8_t FreeSerifItalic18pt7bAdvances[] PROGMEM = {
+    9, 12, 12, 17, 17, 29, 27,  7, 12, 12, 18, 24,  9, 12,  9, 10,
+   17, 17, 17, 18, 17, 18, 18, 17, 18, 17,  9,  9, 20, 23, 20, 16,
+   27, 23, 21, 21, 25, 20, 20, 24, 25, 11, 15, 22, 20, 29, 24, 23,
+   20, 23, 22, 16, 21, 25, 23, 31, 23, 21, 20, 14, 17, 14, 15, 17,
+    9, 17, 17, 14, 18, 14, 15, 15, 17,  9, 10, 16,  9, 25, 17, 17,
+   16, 17, 13, 12,  8, 17, 16, 24, 15, 16, 14, 14, 10, 14, 19 };
+
+const GFXmetrics FreeSerifItalic18pt7bMetrics PROGMEM = {
+  25, 7, 0, 0, (uint8_t *)FreeSerifItalic18pt7bAdvances };
+
 const GFXfont FreeSerifItalic18pt7b PROGMEM = {
   (uint8_t  *)FreeSerifItalic18pt7bBitmaps,
   (GFXglyph *)FreeSerifItalic18pt7bGlyphs,
-  0x20, 0x7E, 42 };
+  0x20, 0x7E, 42,
+  (GFXmetrics *)&FreeSerifItalic18pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 4805 bytes
+// Approx. 4914 bytes
@@ -729,9 +729,24 @@ const GFXglyph FreeSerifItalic24pt7bGlyphs[] PROGMEM = {
   {  7480,  16,  41,  19,    0,  -32 },   // 0x7D '}'
   {  7562,  22,   6,  25,    2,  -14 } }; // 0x7E '~'
 
+const uint8_t FreeSerifItalic24pt7bAdvances[] PROGMEM = {
+   12, 16, 16, 23, 24, 39, 37,  9, 16, 16, 23, 32, 12, 16, 12, 14,
+   23, 23, 24, 23, 23, 24, 23, 23, 23, 23, 12, 12, 27, 31, 27, 21,
+   37, 31, 28, 29, 33, 27, 27, 32, 33, 15, 20, 30, 27, 39, 32, 31,
+   27, 31, 29, 21, 28, 33, 31, 42, 31, 28, 26, 18, 23, 18, 20, 23,
+   12, 23, 22, 19, 23, 19, 20, 21, 23, 12, 13, 21, 12, 34, 23, 22,
+   22, 23, 17, 16, 11, 23, 21, 32, 20, 22, 18, 19, 13, 19, 25 };
+
+const GFXmetrics FreeSerifItalic24pt7bMetrics PROGMEM = {
+  33, 10, 0, 0, (uint8_t *)FreeSerifItalic24pt7bAdvances };
+
 const GFXfont FreeSerifItalic24pt7b PROGMEM = {
   (uint8_t  *)FreeSerifItalic24pt7bBitmaps,
   (GFXglyph *)FreeSerifItalic24pt7bGlyphs,
-  0x20, 0x7E, 56 };
+  0x20, 0x7E, 56,
+  (GFXmetrics *)&FreeSerifItalic24pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 8251 bytes
+// Approx. 8360 bytes
@@ -194,9 +194,24 @@ const GFXglyph FreeSerifItalic9pt7bGlyphs[] PROGMEM = {
   {  1146,   7,  16,   7,    0,  -12 },   // 0x7D '}'
   {  1160,   8,   3,  10,    1,   -5 } }; // 0x7E '~'
 
+const uint8_t FreeSerifItalic9pt7bAdvances[] PROGMEM = {
+    5,  6,  6,  9,  9, 15, 14,  4,  6,  6,  9, 12,  5,  6,  5,  5,
+    9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  4,  4, 10, 12, 10,  8,
+   14, 12, 11, 11, 13, 10, 10, 12, 13,  6,  8, 12, 10, 15, 12, 12,
+   10, 12, 11,  8, 11, 13, 12, 16, 12, 11, 10,  7,  9,  7,  8,  9,
+    5,  9,  9,  7,  9,  7,  8,  8,  9,  4,  5,  8,  5, 13,  9,  9,
+    8,  9,  7,  6,  4,  9,  8, 12,  8,  9,  7,  7,  5,  7, 10 };
+
+const GFXmetrics FreeSerifItalic9pt7bMetrics PROGMEM = {
+  12, 4, 0, 0, (uint8_t *)FreeSerifItalic9pt7bAdvances };
+
 const GFXfont FreeSerifItalic9pt7b PROGMEM = {
   (uint8_t  *)FreeSerifItalic9pt7bBitmaps,
   (GFXglyph *)FreeSerifItalic9pt7bGlyphs,
-  0x20, 0x7E, 22 };
+  0x20, 0x7E, 22,
+  (GFXmetrics *)&FreeSerifItalic9pt7bMetrics,
+  NULL,
+  NULL,
+  NULL };
 
-// Approx. 1835 bytes
+// Approx. 1944 bytes
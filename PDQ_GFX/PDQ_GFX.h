@@ -73,11 +73,32 @@ POSSIBILITY OF SUCH DAMAGE.
 #else
 	#define pgm_read_pointer(addr) ((void *)pgm_read_word(addr))
 #endif
+#if defined(__AVR_HAVE_ELPM__)
+	typedef uint32_t	fontaddr_t;		// flash address of font bitmaps (far, may be above 64KB)
+	#define pgm_read_font_byte(addr) pgm_read_byte_far(addr)
+#else
+	typedef uintptr_t	fontaddr_t;
+	#define pgm_read_font_byte(addr) pgm_read_byte((const uint8_t *)(addr))
+#endif
 
 #include "gfxfont.h"
 
 #define GFX_FONT_PACKED
 
+#if !defined(PDQ_BEZIER_TOLERANCE)
+#define PDQ_BEZIER_TOLERANCE	2	// maximum Bezier curve flattening error (in 1/4 pixel units)
+#endif
+
+// RAM cache of decoded GFX font glyphs (for targets with RAM to spare), define before including:
+//   PDQ_GLYPH_CACHE		number of glyphs kept (0 for no cache)
+//   PDQ_GLYPH_CACHE_SIZE	bytes per glyph (larger glyphs are not cached)
+#if !defined(PDQ_GLYPH_CACHE)
+#define PDQ_GLYPH_CACHE			0
+#endif
+#if !defined(PDQ_GLYPH_CACHE_SIZE)
+#define PDQ_GLYPH_CACHE_SIZE	128
+#endif
+
 typedef int			coord_t;	// type used for coordinates (signed) for parameters (int16_t used for storage)
 typedef uint16_t	color_t;	// type used for colors (unsigned)
 
@@ -104,6 +125,35 @@ static inline T maxValue(T& x, T& y)
 	return x >= y ? x : y;
 }
 
+// gradient fill modes (for fillRectGradient etc.)
+enum
+{
+	GRADIENT_VERTICAL	= 0x00,	// color1 at top to color2 at bottom
+	GRADIENT_HORIZONTAL	= 0x01,	// color1 at left to color2 at right
+	GRADIENT_RADIAL		= 0x02,	// color1 at centre to color2 at max(w,h)/2 from centre
+	GRADIENT_DITHER		= 0x80,	// add 4x4 ordered dither (hides 565 color banding)
+};
+
+// some line patterns (for drawLinePattern etc., 16 pixels, MSB first, 1 bits are drawn)
+enum
+{
+	PATTERN_SOLID		= 0xFFFF,
+	PATTERN_DOT			= 0xAAAA,
+	PATTERN_DASH		= 0xF0F0,
+	PATTERN_LONGDASH	= 0xFF00,
+	PATTERN_DASHDOT		= 0xFE38,
+};
+
+// text layout flags (for drawText)
+enum
+{
+	TEXT_LEFT			= 0x00,
+	TEXT_CENTER			= 0x01,
+	TEXT_RIGHT			= 0x02,
+	TEXT_WORDWRAP		= 0x04,	// wrap lines at spaces inside the box (or mid-word if a word doesn't fit)
+	TEXT_ELLIPSIS		= 0x08,	// end a line with "..." if text is cut off at the box edge
+};
+
 template <class HW>
 class PDQ_GFX : public Print {
 
@@ -137,33 +187,472 @@ public:
 	static void fillTriangle(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, color_t color);
 	static void drawRoundRect(coord_t x0, coord_t y0, coord_t w, coord_t h, coord_t radius, color_t color);
 	static void fillRoundRect(coord_t x0, coord_t y0, coord_t w, coord_t h, coord_t radius, color_t color);
+	static void drawEllipse(coord_t x0, coord_t y0, coord_t rx, coord_t ry, color_t color);
+	static void fillEllipse(coord_t x0, coord_t y0, coord_t rx, coord_t ry, color_t color);
+	static void drawArc(coord_t x0, coord_t y0, coord_t r, int16_t start, int16_t end, color_t color);
+	static void fillArc(coord_t x0, coord_t y0, coord_t r, coord_t inner, int16_t start, int16_t end, color_t color);
+	static inline void fillPie(coord_t x0, coord_t y0, coord_t r, int16_t start, int16_t end, color_t color)	{ fillArc(x0, y0, r, 0, start, end, color); }
+	static void drawBezier(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, color_t color);
+	static void drawBezier(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, coord_t x3, coord_t y3, color_t color);
+	static void fillBezier(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, color_t color);
+	static void fillBezier(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, coord_t x3, coord_t y3, color_t color);
+	static void fillPolygon(const int16_t *xy, uint8_t n, color_t color);
+	static void fillRectGradient(coord_t x, coord_t y, coord_t w, coord_t h, color_t color1, color_t color2, uint8_t mode = GRADIENT_VERTICAL);
+	static void fillRoundRectGradient(coord_t x, coord_t y, coord_t w, coord_t h, coord_t r, color_t color1, color_t color2, uint8_t mode = GRADIENT_VERTICAL);
+	static void fillCircleGradient(coord_t x0, coord_t y0, coord_t r, color_t color1, color_t color2, uint8_t mode = GRADIENT_RADIAL);
+	static color_t blendColor(color_t color1, color_t color2, uint16_t t, uint8_t dither = 8);	// t = 0 (color1) to 256 (color2)
+
+	// Shaded fills.  A shader is any class (or struct) with a member "color_t operator()(coord_t x, coord_t y)"
+	// returning the color for screen pixel x,y (called left to right along each span).  Since it is a
+	// template parameter the call is inlined (no virtual call), each span (or the whole rectangle) uses
+	// one address window and runs of the same color are sent with a single pushColor(color, count).
+	template<class S> static void fillRectShader(coord_t x, coord_t y, coord_t w, coord_t h, S shader);
+	template<class S> static void fillRoundRectShader(coord_t x, coord_t y, coord_t w, coord_t h, coord_t r, S shader);
+	template<class S> static void fillCircleShader(coord_t x0, coord_t y0, coord_t r, S shader);
+	template<class S> static void fillTriangleShader(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, S shader);
+	template<class S> static void fillPolygonShader(const int16_t *xy, uint8_t n, S shader);
+
+	// Patterned (dashed) lines.  The pattern is 16 pixels (MSB first, 1 bits are drawn) starting at
+	// bit "phase", and the phase for the next pixel is returned so lines can continue a pattern.
+	static uint8_t drawLinePattern(coord_t x0, coord_t y0, coord_t x1, coord_t y1, uint16_t pattern, uint8_t phase, color_t color);
+	static inline uint8_t drawFastHLinePattern(coord_t x, coord_t y, coord_t w, uint16_t pattern, uint8_t phase, color_t color)
+	{
+		return (w > 0) ? drawLinePattern(x, y, x+w-1, y, pattern, phase, color) : phase;
+	}
+	static inline uint8_t drawFastVLinePattern(coord_t x, coord_t y, coord_t h, uint16_t pattern, uint8_t phase, color_t color)
+	{
+		return (h > 0) ? drawLinePattern(x, y, x, y+h-1, pattern, phase, color) : phase;
+	}
+	static uint8_t drawRectPattern(coord_t x, coord_t y, coord_t w, coord_t h, uint16_t pattern, uint8_t phase, color_t color);
 	static void drawBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color);
 	static void drawBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color, color_t bg);
 	static void drawBitmap(coord_t x, coord_t y, uint8_t *bitmap, coord_t w, coord_t h, color_t color);
 	static void drawBitmap(coord_t x, coord_t y, uint8_t *bitmap, coord_t w, coord_t h, color_t color, color_t bg);
 	static void drawXBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color);
 	static void drawChar(coord_t x, coord_t y, unsigned char c, color_t color, color_t bg, uint8_t size);
-	static void drawCharGFX(coord_t x, coord_t y, unsigned char c, color_t color, color_t bg, uint8_t size);
+	static void drawCharGFX(coord_t x, coord_t y, uint16_t c, color_t color, color_t bg, uint8_t size);
 	static inline void setCursor(coord_t x, coord_t y);
 	static inline void setTextColor(color_t c);
 	static inline void setTextColor(color_t c, color_t bg);
 	static inline void setTextSize(uint8_t s);
 	static inline void setTextWrap(boolean w);
+	static inline void setTextSmooth(boolean s = true);	// smooth edges of classic font at sizes 2, 3, 4 (and multiples)
 	static inline void cp437(boolean x=true);
-	static inline void setFont(const GFXfont *f = NULL);
+	static inline void setFont(const GFXfont *f = NULL);		// far fonts (NULL bitmap) need the overload below
+	static void setFont(const GFXfont *f, fontaddr_t bitmap);	// font with bitmaps at far address (see GFX_FAR_ADDRESS)
+	static void clearGlyphCache();		// forget cached glyphs (needed only if a font in RAM is changed)
 
 	static inline coord_t width() __attribute__ ((always_inline))				{ return _width; }
 	static inline coord_t height() __attribute__ ((always_inline))			{ return _height; }
 	static inline uint8_t getRotation() __attribute__ ((always_inline))		{ return rotation; }
 	static inline coord_t getCursorX() __attribute__ ((always_inline))		{ return cursor_x; }
 	static inline coord_t getCursorY() __attribute__ ((always_inline))		{ return cursor_y; }
-	static inline void getTextBounds(char *string, coord_t x, coord_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h);
-	static inline void getTextBounds(const __FlashStringHelper *s, coord_t x, coord_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h);
+	static inline coord_t getFontAscent()		{ return gfxFont ? (coord_t)gfxAscent * textsize : 0; }	// rows above baseline (cursor y)
+	static inline coord_t getFontDescent()		{ return (coord_t)(gfxFont ? gfxDescent : 7) * textsize; }	// rows below baseline (cursor y)
+	static inline coord_t getTextWidth(const char *s)					{ return textWidth((const uint8_t *)s, false); }
+	static inline coord_t getTextWidth(const __FlashStringHelper *s)	{ return textWidth((const uint8_t *)s, true); }
+	static inline void getTextBounds(const char *s, coord_t x, coord_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+	{
+		textBounds((const uint8_t *)s, false, x, y, x1, y1, w, h);
+	}
+	static inline void getTextBounds(const __FlashStringHelper *s, coord_t x, coord_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+	{
+		textBounds((const uint8_t *)s, true, x, y, x1, y1, w, h);
+	}
+
+	// Draw text laid out in the box x,y,w,h (top-left and size) with the current font, size and
+	// colors.  Each line is measured up to its break then drawn, so alignment needs no separate
+	// measuring pass.  With a background color the whole box is painted.  Returns height used.
+	static inline coord_t drawText(const char *s, coord_t x, coord_t y, coord_t w, coord_t h, uint8_t flags = TEXT_LEFT)
+	{
+		return textLayout((const uint8_t *)s, false, x, y, w, h, flags);
+	}
+	static inline coord_t drawText(const __FlashStringHelper *s, coord_t x, coord_t y, coord_t w, coord_t h, uint8_t flags = TEXT_LEFT)
+	{
+		return textLayout((const uint8_t *)s, true, x, y, w, h, flags);
+	}
+
+	// Draw text with the current font, size and colors as print() would at cursor x,y, but reading
+	// in direction dir: 0 left to right, 1 top to bottom (turned 90 degrees clockwise), 2 upside
+	// down, 3 bottom to top (e.g. a vertical axis label).  Rotation and cursor are left unchanged.
+	inline void drawTextRotated(const char *s, coord_t x, coord_t y, uint8_t dir)
+	{
+		textRotated((const uint8_t *)s, false, x, y, dir);
+	}
+	inline void drawTextRotated(const __FlashStringHelper *s, coord_t x, coord_t y, uint8_t dir)
+	{
+		textRotated((const uint8_t *)s, true, x, y, dir);
+	}
 
 	virtual size_t write(uint8_t);		// used by Arduino "Print.h" (and the one required virtual function)
+	virtual size_t write(const uint8_t *buffer, size_t size);	// (used by print() of strings)
+	using Print::write;
 
 protected:
+	template<class> friend class PDQ_GFX_Field_;
+
+	static void drawSpan(coord_t x0, coord_t x1, coord_t y, color_t color);	// clipped horizontal span from x0 to x1 (inclusive)
+	static int16_t sin255(int16_t deg);	// sine of angle in degrees, scaled to +/-255
+	template<class T> static void ellipseRows(coord_t x0, coord_t y0, coord_t rx, coord_t ry, uint8_t fill, color_t color);
+	static void drawArcRow(coord_t x0, coord_t y, coord_t xs, coord_t xe, coord_t dy, const int16_t *cs, uint8_t mode, color_t color);
+	static uint8_t flattenBezier(const int16_t *xy, uint8_t order, uint8_t maxshift, int16_t *poly, color_t color);
+	static void drawGlyphGFX(coord_t x, coord_t y, GFXglyph *glyph, color_t color, color_t bg, uint8_t size);
+	static void drawCharGFXOpaque(coord_t x, coord_t y, GFXglyph *glyph, color_t color, color_t bg, uint8_t size);
+	static void drawCharGFXGray(coord_t x, coord_t y, GFXglyph *glyph, color_t color, color_t bg, uint8_t size);
+	static void drawGlyphRow(const uint8_t *bits, uint8_t w, coord_t x, coord_t y, uint8_t size, coord_t h, color_t color);
+	static void drawBitRows(coord_t x, coord_t y, const uint8_t *rows, uint8_t stride, uint8_t w, uint8_t h, uint8_t size, color_t color, color_t bg);
+	static inline uint8_t textByte(const uint8_t *s, uint8_t pgm) __attribute__ ((always_inline))	{ return pgm ? pgm_read_byte(s) : *s; }
+	static uint16_t textChar(const uint8_t *&s, uint8_t pgm);
+	static uint16_t glyphIndex(uint16_t c);
+	static coord_t charAdvance(uint16_t c);
+	static coord_t textWidth(const uint8_t *s, uint8_t pgm);
+	static coord_t kerning(uint16_t prev, uint16_t c);
+	static void drawTextChar(coord_t x, coord_t y, uint16_t c);
+	static void textBounds(const uint8_t *s, uint8_t pgm, coord_t x, coord_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h);
+	static coord_t textLayout(const uint8_t *s, uint8_t pgm, coord_t x, coord_t y, coord_t w, coord_t h, uint8_t flags);
+	void textRotated(const uint8_t *s, uint8_t pgm, coord_t x, coord_t y, uint8_t dir);
+	static void scaleBits(const uint8_t *src, uint8_t sstride, uint8_t w, uint8_t h, uint8_t *dst, uint8_t dstride, uint8_t scale);
+
+	// sequential row decoder for (packed, unpacked, row span, grayscale or Huffman coded) GFXfont
+	// glyph bitmaps (or their decoded rows in glyphCache)
+	struct GlyphBits
+	{
+		fontaddr_t		p, q;
+		uint8_t			packed, bits, bits_cnt, cnt;	// (packed 2: row spans at q, bits of them, cnt is row)
+														// (packed 3: grayscale run of cnt pixels, bits is level)
+		uint8_t			color;							// (packed 4: run color in bit 0, bit 1 if run continues)
+#if PDQ_GLYPH_CACHE
+		const uint8_t	*ram;							// (packed 5: rows in glyphCache)
+#endif
+
+		// bitmapOffset bit 15 flags a packed glyph, unless the font has a bitmapHigh table
+		// (fonts over 32KB) holding offset bits 16-22 and the packed flag in bit 7
+		GlyphBits(GFXglyph *glyph) : bits(0), bits_cnt(0), cnt(0), color(1)
+		{
+			uint32_t bo = pgm_read_word(&glyph->bitmapOffset);
+			if (gfxBitmapHigh)
+			{
+				uint8_t hi = pgm_read_byte(&gfxBitmapHigh[glyph - (GFXglyph *)pgm_read_pointer(&gfxFont->glyph)]);
+				packed = hi >> 7;
+				bo |= (uint32_t)(hi & 0x7F) << 16;
+			}
+			else
+			{
+				packed = bo >> 15;
+				bo &= 0x7FFF;
+			}
+			p = gfxBitmap + bo;
+			if (gfxSpans)
+				packed = 2;
+			if (gfxGray)
+				packed = 3;
+			if (gfxHuffman)
+				packed = 4;
+#if PDQ_GLYPH_CACHE
+			if (!gfxSpans && !gfxGray)	// (their runs draw as fast as cached rows)
+				cached(glyph);
+#endif
+		}
+
+#if PDQ_GLYPH_CACHE
+		// switch to the glyph's decoded copy in glyphCache, decoding it into the least recently
+		// used slot if not there (and it fits).  Cached glyphs are unscaled, so serve any text size.
+		void cached(GFXglyph *glyph)
+		{
+			uint8_t		w	= pgm_read_byte(&glyph->width);
+			uint8_t		h	= pgm_read_byte(&glyph->height);
+			uint16_t	gi	= glyph - (GFXglyph *)pgm_read_pointer(&gfxFont->glyph);
+			uint16_t	len	= (uint16_t)((w + 7) >> 3) * h;
+
+			if ((len == 0) || (len > PDQ_GLYPH_CACHE_SIZE))
+				return;
+
+			GlyphCacheSlot	*s		= glyphCache;
+			GlyphCacheSlot	*lru	= glyphCache;
+			for (; s < &glyphCache[PDQ_GLYPH_CACHE]; s++)
+			{
+				if (s->used && (s->font == gfxFont) && (s->glyph == gi))
+					break;
+				if (s->used < lru->used)
+					lru = s;
+			}
+			if (s == &glyphCache[PDQ_GLYPH_CACHE])
+			{
+				s = lru;
+				uint8_t *d = s->data;
+				for (uint8_t yy = 0; yy < h; yy++, d += (w + 7) >> 3)
+					row(d, w);
+				s->font		= gfxFont;
+				s->glyph	= gi;
+			}
+			if (++glyphTick == 0)	// (on wrap around all cached glyphs become equally old)
+			{
+				for (GlyphCacheSlot *o = glyphCache; o < &glyphCache[PDQ_GLYPH_CACHE]; o++)
+					o->used = o->used ? 1 : 0;
+				glyphTick = 1;
+			}
+			s->used		= glyphTick;
+			ram			= s->data;
+			packed		= 5;
+		}
+#endif
+
+		// load next run of Huffman coded glyph.  Runs alternate between background and set
+		// pixels (starting with background), symbol 63 is 63 pixels continued by the next run.
+		// The font's canonical code table is at the start of its bitmap: number of codes of
+		// each length 1 to 15, then the symbols in code order.
+		void huffman()
+		{
+			if (!(color & 2))
+				color ^= 1;
+			fontaddr_t	t		= gfxBitmap;
+			int16_t		code	= 0;	// code bits so far
+			int16_t		first	= 0;	// first code of this length
+			uint8_t		index	= 0;	// index of first symbol of this length
+			for (uint8_t len = 1; len <= 15; len++)
+			{
+				if (bits_cnt == 0)
+				{
+					bits = pgm_read_font_byte(p++);
+					bits_cnt = 8;
+				}
+				code |= bits >> 7;
+				bits <<= 1;
+				bits_cnt--;
+				uint8_t count = pgm_read_font_byte(t++);
+				if (code - first < count)
+				{
+					cnt = pgm_read_font_byte(gfxBitmap + 15 + index + (code - first));
+					color = (cnt == 63) ? (color | 2) : (color & 1);
+					return;
+				}
+				index	+= count;
+				first	= (first + count) << 1;
+				code	<<= 1;
+			}
+		}
+
+		// next pixel coverage level of grayscale glyph (0 to gfxGrayMax)
+		uint8_t next()
+		{
+			if (cnt == 0)
+				gray();
+			cnt--;
+			return bits;
+		}
+
+		// skip n pixels of grayscale glyph
+		void skip(uint16_t n)
+		{
+			while (n)
+			{
+				if (cnt == 0)
+					gray();
+				uint8_t k = (cnt < n) ? cnt : n;
+				cnt -= k;
+				n -= k;
+			}
+		}
+
+		// load next grayscale run (4bpp: level in high nibble, length-1 in low; 2bpp: level in
+		// top 2 bits, length-1 in low 6)
+		void gray()
+		{
+			uint8_t b = pgm_read_font_byte(p++);
+			if (gfxGray == 4)
+			{
+				bits	= b >> 4;
+				cnt		= (b & 0xF) + 1;
+			}
+			else
+			{
+				bits	= b >> 6;
+				cnt		= (b & 0x3F) + 1;
+			}
+		}
+
+		// decode next w pixel glyph row into out[] (MSB first, set bits are foreground)
+		void row(uint8_t *out, uint8_t w)
+		{
+#if PDQ_GLYPH_CACHE
+			if (packed == 5)
+			{
+				memcpy(out, ram, (w + 7) >> 3);
+				ram += (w + 7) >> 3;
+				return;
+			}
+#endif
+			memset(out, 0, (w + 7) >> 3);
+			if (packed == 4)
+			{
+				for (uint8_t xx = 0; xx < w; )
+				{
+					while (cnt == 0)
+						huffman();
+					uint8_t	n = (cnt < w-xx) ? cnt : w-xx;
+					cnt -= n;
+					if (color & 1)
+					{
+						while (n--)
+						{
+							out[xx >> 3] |= 0x80 >> (xx & 7);
+							xx++;
+						}
+					}
+					else
+						xx += n;
+				}
+			}
+			else if (packed == 3)	// grayscale without background, pixels at least half covered
+			{
+				for (uint8_t xx = 0; xx < w; )
+				{
+					if (cnt == 0)
+						gray();
+					uint8_t	n = (cnt < w-xx) ? cnt : w-xx;
+					cnt -= n;
+					if (bits > (gfxGrayMax >> 1))
+					{
+						while (n--)
+						{
+							out[xx >> 3] |= 0x80 >> (xx & 7);
+							xx++;
+						}
+					}
+					else
+						xx += n;
+				}
+			}
+			else if (packed == 2)
+			{
+				if (pgm_read_font_byte(p) == cnt)	// new spans from this row on
+				{
+					bits = pgm_read_font_byte(++p);
+					q = ++p;
+					p += 2 * bits;
+				}
+				fontaddr_t s = q;
+				for (uint8_t i = bits; i; i--)
+				{
+					uint8_t	xx = pgm_read_font_byte(s++);
+					uint8_t	n = pgm_read_font_byte(s++);
+					while (n--)
+					{
+						out[xx >> 3] |= 0x80 >> (xx & 7);
+						xx++;
+					}
+				}
+				cnt++;
+			}
+			else if (!packed)
+			{
+				for (uint8_t xx = 0; xx < w; xx++)
+				{
+					if (bits_cnt == 0)
+					{
+						bits = pgm_read_font_byte(p++);
+						bits_cnt = 8;
+					}
+					if (bits & 0x80)
+						out[xx >> 3] |= 0x80 >> (xx & 7);
+					bits <<= 1;
+					bits_cnt--;
+				}
+			}
+			else
+			{
+				for (uint8_t xx = 0; xx < w; )
+				{
+					if (bits_cnt == 0)
+					{
+						bits = pgm_read_font_byte(p++);
+						bits_cnt = 2;
+						cnt = (bits & 0x7)+1;
+					}
+					uint8_t	n = (cnt < w-xx) ? cnt : w-xx;
+					cnt -= n;
+					if (bits & 0x8)
+					{
+						while (n--)
+						{
+							out[xx >> 3] |= 0x80 >> (xx & 7);
+							xx++;
+						}
+					}
+					else
+						xx += n;
+					if (cnt == 0)
+					{
+						bits >>= 4;
+						cnt = (bits & 0x7)+1;
+						bits_cnt--;
+					}
+				}
+			}
+		}
+	};
+
+	// span "sinks" that filled primitives hand each scanline span (x0 to x1 inclusive) to
+	struct SolidSpan
+	{
+		color_t	color;
+		inline void operator()(coord_t x0, coord_t x1, coord_t y) __attribute__ ((always_inline))	{ drawSpan(x0, x1, y, color); }
+	};
+	template<class S> struct ShaderSpan
+	{
+		S		&shader;
+		inline void operator()(coord_t x0, coord_t x1, coord_t y) __attribute__ ((always_inline))	{ shadeSpan(x0, x1, y, shader); }
+	};
+	struct GradientSpan
+	{
+		coord_t		x, y, w, h;			// gradient rectangle
+		coord_t		cx, cy;				// centre (for radial)
+		coord_t		by0, by1;			// full-width rows (share one address window)
+		color_t		color1, color2;
+		uint8_t		kind, dither;
+		uint8_t		open;				// full-width window already set
+		uint32_t	dt;					// gradient step per pixel (8.8 fixed point)
+		void operator()(coord_t xa, coord_t xb, coord_t py);
+	};
+	template<class S> static void shadeSpan(coord_t x0, coord_t x1, coord_t y, S &shader);
+	template<class SPAN> static void triangleSpans(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, SPAN &span);
+	template<class SPAN> static void roundRectSpans(coord_t x, coord_t y, coord_t w, coord_t h, coord_t r, SPAN &span);
+	template<class SPAN> static void polygonSpans(const int16_t *xy, uint8_t n, SPAN &span);
+
 	static GFXfont*	gfxFont;
+	static int8_t	gfxAscent;			// highest glyph top above baseline in gfxFont (for opaque text cells)
+	static int8_t	gfxDescent;			// lowest glyph bottom below baseline in gfxFont
+	static uint8_t	gfxFirst, gfxLast;	// character range of gfxFont
+	static GFXrange	*gfxRanges;			// Unicode ranges of gfxFont (or NULL)
+	static uint16_t	gfxRangeCount;
+	static uint16_t	gfxGlyphs;			// number of glyphs in gfxFont
+	static fontaddr_t gfxBitmap;		// flash address of gfxFont bitmaps
+	static uint8_t	*gfxBitmapHigh;		// high offset bits per glyph of gfxFont (or NULL)
+	static uint8_t	gfxSpans;			// gfxFont glyphs are row span lists (GFX_ROW_SPANS)
+	static uint8_t	gfxHuffman;			// gfxFont glyphs are Huffman coded runs (GFX_HUFFMAN)
+	static uint8_t	gfxGray;			// bits per pixel of anti-aliased gfxFont (2 or 4, else 0)
+	static uint8_t	gfxGrayMax;			// highest coverage level of anti-aliased gfxFont
+	static color_t	grayRamp[16];		// colors of coverage levels from textbgcolor to textcolor
+	static color_t	grayColor, grayBg;	// colors grayRamp was computed for
+	static uint8_t	grayMax;			// (and its number of levels - 1, 0 if not computed)
+	static uint8_t	gfxFixed;			// xAdvance of all glyphs if gfxFont is fixed width (else 0)
+	static uint8_t	*gfxAdvance;		// per glyph xAdvance table for gfxFont (or NULL)
+	static uint16_t	*gfxKernIndex;		// kerning pair index for gfxFont (or NULL)
+	static GFXkernPair *gfxKernPairs;
+	static uint16_t	lastChar;			// previous character written (for kerning, 0 at start of line)
+	static uint16_t	utf8Char;			// UTF-8 character being decoded by write()
+	static uint8_t	utf8Left;			// continuation bytes still expected by write()
+#if PDQ_GLYPH_CACHE
+	struct GlyphCacheSlot
+	{
+		GFXfont		*font;
+		uint16_t	glyph;				// glyph index in font
+		uint16_t	used;				// glyphTick when last used (0 if slot empty)
+		uint8_t		data[PDQ_GLYPH_CACHE_SIZE];	// glyph rows (MSB first, padded to whole bytes)
+	};
+	static GlyphCacheSlot glyphCache[PDQ_GLYPH_CACHE];	// recently drawn glyphs of GFX fonts
+	static uint16_t	glyphTick;
+#endif
 	static coord_t	WIDTH, HEIGHT;		// This is the 'raw' display w/h - never changes
 	static coord_t	_width, _height;	// Display w/h as modified by current rotation
 	static coord_t	cursor_x, cursor_y;
@@ -171,6 +660,7 @@ protected:
 	static uint8_t	textsize;
 	static uint8_t	rotation;
 	static boolean	wrap;				// If set, 'wrap' text at right edge of display
+	static boolean	smooth;				// If set, smooth scaled classic font (Scale2x/Scale3x)
 	static boolean	_cp437;				// If set, use correct CP437 charset (default is off)
 };
 
@@ -200,6 +690,33 @@ private:
 	boolean		currstate, laststate;
 };
 
+// Text field (e.g. a numeric readout) that redraws only the character cells that changed.
+// Characters are drawn as opaque cells, so bgcolor must differ from textcolor.
+template <class HW>
+class PDQ_GFX_Field_
+{
+public:
+	PDQ_GFX_Field_();
+	void		initField(PDQ_GFX<HW> *gfx, coord_t x, coord_t y, coord_t w, const GFXfont *font, uint8_t textsize, color_t textcolor, color_t bgcolor, uint8_t align = TEXT_RIGHT);
+	void		drawField();									// redraw whole field (e.g. after screen was cleared)
+	void		setText(const char *s);							// show text (drawing only cells that changed)
+	void		setValue(long value, uint8_t decimals = 0);		// show number with decimals digits after the point
+
+private:
+	enum { MAX_CHARS = 16 };
+
+	void		select();										// set gfx font, size and colors for field
+
+	PDQ_GFX<HW>	*_gfx;
+	const GFXfont	*_font;
+	int16_t		_x, _y, _w;
+	int16_t		_left, _right;									// extent of text drawn
+	uint8_t		_textsize, _align, _len;
+	color_t		_textcolor, _bgcolor;
+	uint16_t	_chars[MAX_CHARS];								// characters drawn
+	int16_t		_cellx[MAX_CHARS];								// ...and their cell x positions
+};
+
 // -----------------------------------------------
 extern const unsigned char glcdfont[] PROGMEM;
 
@@ -226,9 +743,65 @@ uint8_t		PDQ_GFX<HW>::rotation;
 template<class HW>
 boolean		PDQ_GFX<HW>::wrap;			// If set, 'wrap' text at right edge of display
 template<class HW>
+boolean		PDQ_GFX<HW>::smooth;		// If set, smooth scaled classic font (Scale2x/Scale3x)
+template<class HW>
 boolean		PDQ_GFX<HW>::_cp437;		// If set, use correct CP437 charset (default is off)
 template<class HW>
 GFXfont		*PDQ_GFX<HW>::gfxFont;
+template<class HW>
+int8_t		PDQ_GFX<HW>::gfxAscent;
+template<class HW>
+int8_t		PDQ_GFX<HW>::gfxDescent;
+template<class HW>
+uint8_t		PDQ_GFX<HW>::gfxFirst;
+template<class HW>
+uint8_t		PDQ_GFX<HW>::gfxLast;
+template<class HW>
+GFXrange	*PDQ_GFX<HW>::gfxRanges;
+template<class HW>
+uint16_t	PDQ_GFX<HW>::gfxRangeCount;
+template<class HW>
+uint16_t	PDQ_GFX<HW>::gfxGlyphs;
+template<class HW>
+fontaddr_t	PDQ_GFX<HW>::gfxBitmap;
+template<class HW>
+uint8_t		*PDQ_GFX<HW>::gfxBitmapHigh;
+template<class HW>
+uint8_t		PDQ_GFX<HW>::gfxSpans;
+template<class HW>
+uint8_t		PDQ_GFX<HW>::gfxHuffman;
+template<class HW>
+uint8_t		PDQ_GFX<HW>::gfxGray;
+template<class HW>
+uint8_t		PDQ_GFX<HW>::gfxGrayMax;
+template<class HW>
+color_t		PDQ_GFX<HW>::grayRamp[16];
+template<class HW>
+color_t		PDQ_GFX<HW>::grayColor;
+template<class HW>
+color_t		PDQ_GFX<HW>::grayBg;
+template<class HW>
+uint8_t		PDQ_GFX<HW>::grayMax;
+template<class HW>
+uint8_t		PDQ_GFX<HW>::gfxFixed;
+template<class HW>
+uint8_t		*PDQ_GFX<HW>::gfxAdvance;
+template<class HW>
+uint16_t	*PDQ_GFX<HW>::gfxKernIndex;
+template<class HW>
+GFXkernPair	*PDQ_GFX<HW>::gfxKernPairs;
+template<class HW>
+uint16_t	PDQ_GFX<HW>::lastChar;
+template<class HW>
+uint16_t	PDQ_GFX<HW>::utf8Char;
+template<class HW>
+uint8_t		PDQ_GFX<HW>::utf8Left;
+#if PDQ_GLYPH_CACHE
+template<class HW>
+typename PDQ_GFX<HW>::GlyphCacheSlot PDQ_GFX<HW>::glyphCache[PDQ_GLYPH_CACHE];
+template<class HW>
+uint16_t	PDQ_GFX<HW>::glyphTick;
+#endif
 
 template<class HW>
 PDQ_GFX<HW>::PDQ_GFX(coord_t w, coord_t h)
@@ -244,6 +817,7 @@ PDQ_GFX<HW>::PDQ_GFX(coord_t w, coord_t h)
 	textcolor	= 0xffff;
 	textbgcolor	= 0xffff;
 	wrap		= true;
+	smooth		= false;
 	_cp437		= false;
 	gfxFont		= NULL;
 }
@@ -433,6 +1007,103 @@ void PDQ_GFX<HW>::drawRect(coord_t x, coord_t y, coord_t w, coord_t h, color_t c
 	HW::drawFastVLine(x+w-1,  y	, h, color);
 }
 
+// Draw a patterned line from x0,y0 to x1,y1 (Bresenham).  Consecutive drawn pixels along the
+// major axis are merged and emitted as one horizontal (or vertical) run per dash.
+template<class HW>
+uint8_t PDQ_GFX<HW>::drawLinePattern(coord_t x0, coord_t y0, coord_t x1, coord_t y1, uint16_t pattern, uint8_t phase, color_t color)
+{
+	coord_t	dx		= abs(x1 - x0);
+	coord_t	dy		= abs(y1 - y0);
+	int8_t	steep	= dy > dx;
+	coord_t	major	= steep ? dy : dx;
+	coord_t	minor	= steep ? dx : dy;
+	coord_t	err		= major / 2;
+	int8_t	pstep	= 1;
+	uint8_t	endphase = (phase + major + 1) & 0xF;
+
+	// step in the same direction as drawLine (so the same pixels are plotted) and run the pattern
+	// backwards if that is toward the start point
+	if (steep ? (y0 > y1) : (x0 > x1))
+	{
+		swapValue(x0, x1);
+		swapValue(y0, y1);
+		phase += major;
+		pstep = -1;
+	}
+	int8_t	sx		= (x0 < x1) ? 1 : -1;
+	int8_t	sy		= (y0 < y1) ? 1 : -1;
+	coord_t	rx		= x0;		// first and last pixel of current run
+	coord_t	ry		= y0;
+	coord_t	ex		= x0;
+	coord_t	ey		= y0;
+	coord_t	len		= 0;
+
+	phase &= 0xF;
+	for (coord_t i = 0; i <= major; i++)
+	{
+		uint8_t on = (pattern & (0x8000 >> phase)) != 0;
+		if (on)
+		{
+			if (!len)
+			{
+				rx = x0;
+				ry = y0;
+			}
+			ex = x0;
+			ey = y0;
+			len++;
+		}
+		phase = (phase + pstep) & 0xF;
+
+		uint8_t minorstep = 0;
+		err -= minor;
+		if (err < 0)
+		{
+			err += major;
+			minorstep = 1;
+			if (steep)
+				x0 += sx;
+			else
+				y0 += sy;
+		}
+		if (steep)
+			y0 += sy;
+		else
+			x0 += sx;
+
+		// run ends at a gap, a minor axis step or the end of the line
+		if (len && (!on || minorstep || i == major))
+		{
+			if (steep)
+				HW::drawFastVLine(rx, (ry < ey) ? ry : ey, len, color);
+			else
+				drawSpan((rx < ex) ? rx : ex, (rx < ex) ? ex : rx, ry, color);
+			len = 0;
+		}
+	}
+
+	return endphase;
+}
+
+// Draw a patterned rectangle outline (pattern continues clockwise from top-left)
+template<class HW>
+uint8_t PDQ_GFX<HW>::drawRectPattern(coord_t x, coord_t y, coord_t w, coord_t h, uint16_t pattern, uint8_t phase, color_t color)
+{
+	if ((w <= 0) || (h <= 0))
+		return phase;
+	if ((w == 1) || (h == 1))
+		return drawLinePattern(x, y, x+w-1, y+h-1, pattern, phase, color);
+
+	phase = drawLinePattern(x, y, x+w-1, y, pattern, phase, color);
+	if (h > 2)
+		phase = drawLinePattern(x+w-1, y+1, x+w-1, y+h-2, pattern, phase, color);
+	phase = drawLinePattern(x+w-1, y+h-1, x, y+h-1, pattern, phase, color);
+	if (h > 2)
+		phase = drawLinePattern(x, y+h-2, x, y+1, pattern, phase, color);
+
+	return phase;
+}
+
 template<class HW>
 void PDQ_GFX<HW>::drawFastVLine_(coord_t x, coord_t y, coord_t h, color_t color)
 {
@@ -503,7 +1174,25 @@ void PDQ_GFX<HW>::drawTriangle(coord_t x0, coord_t y0, coord_t x1, coord_t y1, c
 
 // Fill a triangle
 template<class HW>
-void PDQ_GFX<HW>::fillTriangle( coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, color_t color)
+void PDQ_GFX<HW>::fillTriangle(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, color_t color)
+{
+	SolidSpan	span = { color };
+	triangleSpans(x0, y0, x1, y1, x2, y2, span);
+}
+
+// Fill a triangle using a shader
+template<class HW>
+template<class S>
+void PDQ_GFX<HW>::fillTriangleShader(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, S shader)
+{
+	ShaderSpan<S>	span = { shader };
+	triangleSpans(x0, y0, x1, y1, x2, y2, span);
+}
+
+// Scan convert a triangle into horizontal spans
+template<class HW>
+template<class SPAN>
+void PDQ_GFX<HW>::triangleSpans(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, SPAN &span)
 {
 	coord_t a, b, y, last;
 
@@ -535,7 +1224,7 @@ void PDQ_GFX<HW>::fillTriangle( coord_t x0, coord_t y0, coord_t x1, coord_t y1,
 			a = x2;
 		else if (x2 > b)
 			b = x2;
-		HW::drawFastHLine(a, y0, b-a+1, color);
+		span(a, b, y0);
 		return;
 	}
 
@@ -571,7 +1260,7 @@ void PDQ_GFX<HW>::fillTriangle( coord_t x0, coord_t y0, coord_t x1, coord_t y1,
 		*/
 		if (a > b)
 			swapValue(a, b);
-		HW::drawFastHLine(a, y, b-a+1, color);
+		span(a, b, y);
 	}
 
 	// For lower part of triangle, find scanline crossings for segments
@@ -590,41 +1279,831 @@ void PDQ_GFX<HW>::fillTriangle( coord_t x0, coord_t y0, coord_t x1, coord_t y1,
 		*/
 		if (a > b)
 			swapValue(a, b);
-		HW::drawFastHLine(a, y, b-a+1, color);
+		span(a, b, y);
 	}
 }
 
-// Draw a 1-bit image (bitmap) at the specified (x, y) position from the
-// provided bitmap buffer (must be PROGMEM memory) using the specified
-// foreground color (unset bits are transparent).
+// Draw a horizontal span from x0 to x1 (inclusive) clipped to the screen
 template<class HW>
-void PDQ_GFX<HW>::drawBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color)
+void PDQ_GFX<HW>::drawSpan(coord_t x0, coord_t x1, coord_t y, color_t color)
 {
-	coord_t i, j, byteWidth = (w + 7) / 8;
-	uint8_t byte;
+	if ((y < 0) || (y >= _height))
+		return;
+	if (x0 < 0)
+		x0 = 0;
+	if (x1 >= _width)
+		x1 = _width - 1;
+	if (x0 <= x1)
+		HW::drawFastHLine(x0, y, x1-x0+1, color);
+}
 
-	for (j = 0; j < h; j++)
+// Draw an ellipse outline (midpoint style, emitted as one horizontal run per side per scanline)
+template<class HW>
+void PDQ_GFX<HW>::drawEllipse(coord_t x0, coord_t y0, coord_t rx, coord_t ry, color_t color)
+{
+	if ((rx < 0) || (ry < 0))
+		return;
+	if ((rx <= 1000) && (ry <= 1000))
+		ellipseRows<int32_t>(x0, y0, rx, ry, 0, color);
+	else
+		ellipseRows<int64_t>(x0, y0, rx, ry, 0, color);
+}
+
+// Fill an ellipse (one horizontal span per scanline)
+template<class HW>
+void PDQ_GFX<HW>::fillEllipse(coord_t x0, coord_t y0, coord_t rx, coord_t ry, color_t color)
+{
+	if ((rx < 0) || (ry < 0))
+		return;
+	if ((rx <= 1000) && (ry <= 1000))
+		ellipseRows<int32_t>(x0, y0, rx, ry, 1, color);
+	else
+		ellipseRows<int64_t>(x0, y0, rx, ry, 1, color);
+}
+
+// Scan an ellipse row by row from the centre out and draw each row's outline runs (or fill
+// span).  Only the error e = t - x*x*b2 is kept (x*x*b2 <= t is inside, t for the current row),
+// changing by a2*(2y+1) per row and b2*(2x-1) per x step, both tracked by adding 2*a2 and 2*b2,
+// so the loop only adds and compares.  Terms are at most about max(a2*ry, b2*rx)*2, so T is
+// int32_t for radii up to 1000 and int64_t (only needed for huge off-screen radii) beyond.
+template<class HW>
+template<class T>
+void PDQ_GFX<HW>::ellipseRows(coord_t x0, coord_t y0, coord_t rx, coord_t ry, uint8_t fill, color_t color)
+{
+	T		a2	= (T)rx * rx;
+	T		b2	= (T)ry * ry;
+	T		e	= (a2 * ry + b2 * rx) / 2;
+	T		dy	= a2;					// a2*(2y+1)
+	T		dx	= b2 * (2*rx - 1);		// b2*(2x-1)
+	coord_t	x	= rx;					// half-width of current row
+
+	for (coord_t y = 0; y <= ry; y++)
 	{
-		for (i = 0; i < w; i++)
+		// find half-width of next row out (the outline run for this row connects to it)
+		e	-= dy;
+		dy	+= 2*a2;
+		coord_t nx = x;
+		while ((nx >= 0) && (e < 0))
 		{
-			if (i % 8 == 0)
-				byte = pgm_read_byte(bitmap + j * byteWidth + i / 8);
-			else
-				byte <<= 1;
+			e	+= dx;
+			dx	-= 2*b2;
+			nx--;
+		}
+		if (y == ry)
+			nx = -1;
 
-			if (byte & 0x80)
-				HW::drawPixel(x+i, y+j, color);
+		coord_t xs = (nx < x) ? nx + 1 : x;
+		if (fill || (xs == 0))
+		{
+			drawSpan(x0 - x, x0 + x, y0 + y, color);
+			if (y)
+				drawSpan(x0 - x, x0 + x, y0 - y, color);
+		}
+		else
+		{
+			drawSpan(x0 - x, x0 - xs, y0 + y, color);
+			drawSpan(x0 + xs, x0 + x, y0 + y, color);
+			if (y)
+			{
+				drawSpan(x0 - x, x0 - xs, y0 - y, color);
+				drawSpan(x0 + xs, x0 + x, y0 - y, color);
+			}
 		}
+		x = nx;
 	}
 }
 
-// Draw a 1-bit image (bitmap) at the specified (x, y) position from the
-// provided bitmap buffer (must be PROGMEM memory) using the specified
-// foreground (for set bits) and background (for clear bits) colors.
+// Sine of angle (in degrees) scaled to +/-255
 template<class HW>
-void PDQ_GFX<HW>::drawBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color, color_t bg)
+int16_t PDQ_GFX<HW>::sin255(int16_t deg)
 {
-	coord_t i, j, byteWidth = (w + 7) / 8;
+	static const uint8_t sintab[91] PROGMEM =
+	{
+		0, 4, 9, 13, 18, 22, 27, 31, 35, 40, 44, 49, 53, 57, 62, 66,
+		70, 75, 79, 83, 87, 91, 96, 100, 104, 108, 112, 116, 120, 124, 127, 131,
+		135, 139, 143, 146, 150, 153, 157, 160, 164, 167, 171, 174, 177, 180, 183, 186,
+		190, 192, 195, 198, 201, 204, 206, 209, 211, 214, 216, 219, 221, 223, 225, 227,
+		229, 231, 233, 235, 236, 238, 240, 241, 243, 244, 245, 246, 247, 248, 249, 250,
+		251, 252, 253, 253, 254, 254, 254, 255, 255, 255, 255
+	};
+
+	deg %= 360;
+	if (deg < 0)
+		deg += 360;
+	if (deg >= 180)
+		return -sin255(deg - 180);
+	if (deg > 90)
+		deg = 180 - deg;
+	return pgm_read_byte(&sintab[deg]);
+}
+
+// Draw one scanline of a ring (dy is row relative to centre) spanning xs to xe from
+// centre on each side, clipped to the angle range in cs[] (cos/sin of start and end).
+// mode 0 = full circle, 1 = sweep of 180 degrees or less, 2 = sweep over 180 degrees.
+template<class HW>
+void PDQ_GFX<HW>::drawArcRow(coord_t x0, coord_t y, coord_t xs, coord_t xe, coord_t dy, const int16_t *cs, uint8_t mode, color_t color)
+{
+	if ((y < 0) || (y >= _height))
+		return;
+
+	coord_t	lo[2], hi[2];
+	uint8_t	n = 1;
+
+	lo[0] = -xe;
+	hi[0] = xe;
+	if (mode)
+	{
+		// Pixel (x,dy) is clockwise of start when s0*x <= c0*dy and
+		// counter-clockwise of end when -s1*x <= -c1*dy.
+		for (uint8_t i = 0; i < 2; i++)
+		{
+			int16_t	a = i ? -cs[3] : cs[1];
+			int32_t	b = i ? -(int32_t)cs[2] * dy : (int32_t)cs[0] * dy;
+			int32_t	q;
+
+			lo[i] = -xe;
+			hi[i] = xe;
+			if (a > 0)		// x <= floor(b / a)
+			{
+				q = (b >= 0) ? b / a : -((-b + a - 1) / a);
+				if (q < xe)
+					hi[i] = (coord_t)q;
+			}
+			else if (a < 0)		// x >= ceil(b / a)
+			{
+				q = (b <= 0) ? (-b - a - 1) / -a : -(b / -a);
+				if (q > -xe)
+					lo[i] = (coord_t)q;
+			}
+			else if (b < 0)		// on the ray's axis, all or nothing
+			{
+				lo[i] = xe + 1;
+			}
+		}
+		if (mode == 1)	// intersection of both half-planes
+		{
+			if (lo[1] > lo[0])
+				lo[0] = lo[1];
+			if (hi[1] < hi[0])
+				hi[0] = hi[1];
+		}
+		else if ((lo[1] > hi[1]) || ((lo[0] <= hi[0]) && (lo[1] <= hi[0] + 1) && (lo[0] <= hi[1] + 1)))	// union, merge if overlapping
+		{
+			if (lo[1] <= hi[1])
+			{
+				if (lo[1] < lo[0])
+					lo[0] = lo[1];
+				if (hi[1] > hi[0])
+					hi[0] = hi[1];
+			}
+		}
+		else
+		{
+			n = 2;
+		}
+	}
+
+	for (uint8_t i = 0; i < n; i++)
+	{
+		if (xs == 0)
+		{
+			drawSpan(x0 + lo[i], x0 + hi[i], y, color);
+		}
+		else
+		{
+			if (lo[i] <= -xs)
+				drawSpan(x0 + lo[i], x0 + ((hi[i] < -xs) ? hi[i] : -xs), y, color);
+			if (hi[i] >= xs)
+				drawSpan(x0 + ((lo[i] > xs) ? lo[i] : xs), x0 + hi[i], y, color);
+		}
+	}
+}
+
+// Draw a circular arc from angle start to end (in degrees, clockwise from 3 o'clock)
+template<class HW>
+void PDQ_GFX<HW>::drawArc(coord_t x0, coord_t y0, coord_t r, int16_t start, int16_t end, color_t color)
+{
+	fillArc(x0, y0, r, r, start, end, color);
+}
+
+// Fill a ring segment covering radius inner to r (inclusive) from angle start to end
+// (in degrees, clockwise from 3 o'clock).  An inner radius of 0 fills a pie slice.
+template<class HW>
+void PDQ_GFX<HW>::fillArc(coord_t x0, coord_t y0, coord_t r, coord_t inner, int16_t start, int16_t end, color_t color)
+{
+	if (r < 0)
+		return;
+	if (inner < 0)
+		inner = 0;
+	if (inner > r)
+		inner = r;
+
+	int16_t	cs[4];
+	uint8_t	mode = 0;
+	int16_t	sweep = end - start;
+
+	if (sweep < 360)
+	{
+		sweep %= 360;
+		if (sweep < 0)
+			sweep += 360;
+		if (sweep == 0)
+			return;
+		mode = (sweep <= 180) ? 1 : 2;
+		cs[0] = sin255(start + 90);
+		cs[1] = sin255(start);
+		cs[2] = sin255(end + 90);
+		cs[3] = sin255(end);
+	}
+
+	// Outer edge is x*x <= r*r+r - y*y, hole edge is the same for radius inner-1
+	coord_t	ri	= inner - 1;
+	int32_t	to	= (int32_t)r * r + r;
+	int32_t	ti	= (int32_t)ri * ri + ri;
+	int32_t	xo2	= (int32_t)r * r;
+	int32_t	xi2	= (int32_t)ri * ri;
+	coord_t	xo	= r;
+	coord_t	xi	= ri;
+
+	for (coord_t y = 0; y <= r; y++)
+	{
+		// half-width of next row out (so thin rings stay connected)
+		int32_t	t	= to - (2*y + 1);
+		coord_t	nx	= xo;
+		int32_t	nx2	= xo2;
+		while ((nx >= 0) && (nx2 > t))
+		{
+			nx2 -= 2*nx - 1;
+			nx--;
+		}
+		if (y == r)
+			nx = -1;
+
+		// half-width of hole on this row
+		while ((xi >= 0) && (xi2 > ti))
+		{
+			xi2 -= 2*xi - 1;
+			xi--;
+		}
+
+		coord_t xs = minValue(xi, nx) + 1;
+		if (xs > xo)
+			xs = xo;
+
+		drawArcRow(x0, y0 + y, xs, xo, y, cs, mode, color);
+		if (y)
+			drawArcRow(x0, y0 - y, xs, xo, -y, cs, mode, color);
+
+		to	= t;
+		ti	-= 2*y + 1;
+		xo	= nx;
+		xo2	= nx2;
+	}
+}
+
+// Flatten a quadratic (order 2) or cubic (order 3) Bezier curve with control points xy[]
+// using fixed-point forward differencing.  The number of segments is the smallest power
+// of two (up to 1<<maxshift) keeping the error under PDQ_BEZIER_TOLERANCE, so the
+// differences stay exact integers and each point is just a rounding shift.  Segments are
+// drawn with drawLine, or if poly is not NULL the points are stored there instead.
+// Returns number of points.
+template<class HW>
+uint8_t PDQ_GFX<HW>::flattenBezier(const int16_t *xy, uint8_t order, uint8_t maxshift, int16_t *poly, color_t color)
+{
+	int32_t	v[2], d1[2], d2[2], d3[2];
+	int32_t	need = 0;
+
+	// curve deviates from chord by at most 1/8 of its second derivative / n^2
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		int32_t	dd = labs((int32_t)xy[i] - 2*(int32_t)xy[2+i] + xy[4+i]);
+		if (order == 3)
+		{
+			int32_t	dd2 = labs((int32_t)xy[2+i] - 2*(int32_t)xy[4+i] + xy[6+i]);
+			if (dd2 > dd)
+				dd = dd2;
+			dd *= 3;
+		}
+		need += dd;
+	}
+
+	// points are scaled by 2^(order*k) and must stay within 32 bits
+	int32_t	m = 0;
+	for (uint8_t i = 0; i < 2*(order+1); i++)
+	{
+		int32_t	a = labs((int32_t)xy[i]);
+		if (a > m)
+			m = a;
+	}
+
+	uint8_t	k = 0;
+	while ((k < maxshift) && (((int32_t)PDQ_BEZIER_TOLERANCE << (2*k)) < need) && !(m >> (30 - order*(k+1))))
+		k++;
+
+	// (scaled by multiplying, left shifts of negative values are undefined)
+	uint8_t	s	= order * k;
+	int32_t	seg	= (int32_t)1 << k;		// number of segments
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		int32_t	p0 = xy[i], p1 = xy[2+i], p2 = xy[4+i];
+		if (order == 3)
+		{
+			int32_t	p3 = xy[6+i];
+			int32_t	a = -p0 + 3*p1 - 3*p2 + p3;
+			int32_t	b = 3*p0 - 6*p1 + 3*p2;
+			int32_t	c = 3*(p1 - p0);
+			v[i]	= p0 * ((int32_t)1 << s);
+			d1[i]	= a + b * seg + c * seg * seg;
+			d2[i]	= 6*a + 2 * b * seg;
+			d3[i]	= 6*a;
+		}
+		else
+		{
+			int32_t	a = p0 - 2*p1 + p2;
+			int32_t	b = 2*(p1 - p0);
+			v[i]	= p0 * ((int32_t)1 << s);
+			d1[i]	= a + b * seg;
+			d2[i]	= 2*a;
+			d3[i]	= 0;
+		}
+	}
+
+	coord_t	px = xy[0];
+	coord_t	py = xy[1];
+	uint8_t	n = 1;
+	int32_t	half = s ? (1L << (s-1)) : 0;
+
+	if (poly)
+	{
+		poly[0] = px;
+		poly[1] = py;
+	}
+	for (uint16_t i = 1 << k; i; i--)
+	{
+		for (uint8_t j = 0; j < 2; j++)
+		{
+			v[j]	+= d1[j];
+			d1[j]	+= d2[j];
+			d2[j]	+= d3[j];
+		}
+		coord_t	nx = (coord_t)((v[0] + half) >> s);
+		coord_t	ny = (coord_t)((v[1] + half) >> s);
+		if ((nx == px) && (ny == py))
+			continue;
+		if (poly)
+		{
+			poly[2*n] = nx;
+			poly[2*n+1] = ny;
+		}
+		else
+		{
+			HW::drawLine(px, py, nx, ny, color);
+		}
+		px = nx;
+		py = ny;
+		n++;
+	}
+	if (!poly && (n == 1))
+		HW::drawPixel(px, py, color);
+
+	return n;
+}
+
+// Draw a quadratic Bezier curve from x0,y0 to x2,y2 with control point x1,y1
+template<class HW>
+void PDQ_GFX<HW>::drawBezier(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, color_t color)
+{
+	int16_t	xy[6] = { (int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y2 };
+	flattenBezier(xy, 2, 6, NULL, color);
+}
+
+// Draw a cubic Bezier curve from x0,y0 to x3,y3 with control points x1,y1 and x2,y2
+template<class HW>
+void PDQ_GFX<HW>::drawBezier(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, coord_t x3, coord_t y3, color_t color)
+{
+	int16_t	xy[8] = { (int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y2, (int16_t)x3, (int16_t)y3 };
+	flattenBezier(xy, 3, 6, NULL, color);
+}
+
+// Fill the shape enclosed by a quadratic Bezier curve and the line from its end back to its start
+template<class HW>
+void PDQ_GFX<HW>::fillBezier(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, color_t color)
+{
+	int16_t	xy[6] = { (int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y2 };
+	int16_t	poly[2*(16+1)];
+	fillPolygon(poly, flattenBezier(xy, 2, 4, poly, color), color);
+}
+
+// Fill the shape enclosed by a cubic Bezier curve and the line from its end back to its start
+template<class HW>
+void PDQ_GFX<HW>::fillBezier(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, coord_t x3, coord_t y3, color_t color)
+{
+	int16_t	xy[8] = { (int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y2, (int16_t)x3, (int16_t)y3 };
+	int16_t	poly[2*(32+1)];
+	fillPolygon(poly, flattenBezier(xy, 3, 5, poly, color), color);
+}
+
+// Fill a polygon with n vertices (xy[] holds x0, y0, x1, y1, ...) using the even-odd rule
+template<class HW>
+void PDQ_GFX<HW>::fillPolygon(const int16_t *xy, uint8_t n, color_t color)
+{
+	SolidSpan	span = { color };
+	polygonSpans(xy, n, span);
+}
+
+// Fill a polygon using a shader
+template<class HW>
+template<class S>
+void PDQ_GFX<HW>::fillPolygonShader(const int16_t *xy, uint8_t n, S shader)
+{
+	ShaderSpan<S>	span = { shader };
+	polygonSpans(xy, n, span);
+}
+
+// Scan convert a polygon into one horizontal span per pair of edge crossings on each
+// scanline (up to 16 crossings per scanline, plenty for curves and typical shapes).
+template<class HW>
+template<class SPAN>
+void PDQ_GFX<HW>::polygonSpans(const int16_t *xy, uint8_t n, SPAN &span)
+{
+	if (n == 0)
+		return;
+
+	coord_t	ymin = xy[1];
+	coord_t	ymax = xy[1];
+	for (uint8_t i = 1; i < n; i++)
+	{
+		if (xy[2*i+1] < ymin)
+			ymin = xy[2*i+1];
+		if (xy[2*i+1] > ymax)
+			ymax = xy[2*i+1];
+	}
+	coord_t	yend = (ymax < _height) ? ymax : _height - 1;
+
+	for (coord_t y = (ymin > 0) ? ymin : 0; y <= yend; y++)
+	{
+		coord_t	xs[16];
+		uint8_t	nx = 0;
+
+		for (uint8_t i = 0, j = n-1; i < n; j = i++)
+		{
+			coord_t	xa = xy[2*j], ya = xy[2*j+1];
+			coord_t	xb = xy[2*i], yb = xy[2*i+1];
+			if (ya == yb)
+				continue;
+			if (ya > yb)
+			{
+				swapValue(xa, xb);
+				swapValue(ya, yb);
+			}
+			// edges cover ya <= y < yb (and the bottom row of the polygon)
+			if ((y < ya) || (y > yb) || ((y == yb) && (y != ymax)))
+				continue;
+
+			int32_t	num = (int32_t)(y - ya) * (xb - xa);
+			coord_t	dy = yb - ya;
+			coord_t	x = xa + (coord_t)((num >= 0) ? (num + dy/2) / dy : -((-num + dy/2) / dy));
+
+			// insertion sort crossings
+			if (nx < sizeof (xs) / sizeof (xs[0]))
+			{
+				uint8_t k = nx++;
+				for (; k && (xs[k-1] > x); k--)
+					xs[k] = xs[k-1];
+				xs[k] = x;
+			}
+		}
+
+		for (uint8_t i = 0; i+1 < nx; i += 2)
+			span(xs[i], xs[i+1], y);
+	}
+}
+
+// Blend two 565 colors, t = 0 (color1) to 256 (color2).  Channels are blended with 4
+// extra fraction bits and dither (0-15) is added before truncation (8 rounds).
+template<class HW>
+color_t PDQ_GFX<HW>::blendColor(color_t color1, color_t color2, uint16_t t, uint8_t dither)
+{
+	uint16_t	s = 256 - t;
+	uint8_t		r = ((((color1 >> 11) * s + (color2 >> 11) * t) >> 4) + dither) >> 4;
+	uint8_t		g = (((((color1 >> 5) & 0x3F) * s + ((color2 >> 5) & 0x3F) * t) >> 4) + dither) >> 4;
+	uint8_t		b = ((((color1 & 0x1F) * s + (color2 & 0x1F) * t) >> 4) + dither) >> 4;
+
+	return ((color_t)r << 11) | ((color_t)g << 5) | b;
+}
+
+// Fill a rectangle with a gradient (see GRADIENT_* modes)
+template<class HW>
+void PDQ_GFX<HW>::fillRectGradient(coord_t x, coord_t y, coord_t w, coord_t h, color_t color1, color_t color2, uint8_t mode)
+{
+	fillRoundRectGradient(x, y, w, h, 0, color1, color2, mode);
+}
+
+// Fill a circle with a gradient (radial from centre by default)
+template<class HW>
+void PDQ_GFX<HW>::fillCircleGradient(coord_t x0, coord_t y0, coord_t r, color_t color1, color_t color2, uint8_t mode)
+{
+	fillRoundRectGradient(x0-r, y0-r, 2*r+1, 2*r+1, r, color1, color2, mode);
+}
+
+// Fill a rounded rectangle with a gradient.  The outline comes from roundRectSpans and each
+// span is streamed with pushColor (runs of the same color merged) into one address window for
+// the full-width rows and one per corner row, so a gradient rectangle costs a single window.
+template<class HW>
+void PDQ_GFX<HW>::fillRoundRectGradient(coord_t x, coord_t y, coord_t w, coord_t h, coord_t r, color_t color1, color_t color2, uint8_t mode)
+{
+	if ((w <= 0) || (h <= 0) || (x >= _width) || (y >= _height) || (x+w <= 0) || (y+h <= 0))
+		return;
+	if (r < 0)
+		r = 0;
+	if (2*r > w)
+		r = w/2;
+	if (2*r > h)
+		r = h/2;
+
+	uint8_t		kind	= mode & ~GRADIENT_DITHER;
+	coord_t		rr		= ((w > h) ? w : h) / 2;
+	uint32_t	dt		= 0;
+
+	if (kind == GRADIENT_HORIZONTAL)
+		dt = (w > 1) ? (256UL << 8) / (w-1) : 0;
+	else if (kind == GRADIENT_RADIAL)
+		dt = (rr > 0) ? (256UL << 8) / rr : 0;
+
+	GradientSpan	span = { x, y, w, h, (coord_t)(x + (w-1)/2), (coord_t)(y + (h-1)/2), (coord_t)(y + r), (coord_t)(y + h-1 - r),
+							 color1, color2, kind, (uint8_t)(mode & GRADIENT_DITHER), 0, dt };
+	roundRectSpans(x, y, w, h, r, span);
+}
+
+// Gradient span sink for fillRoundRectGradient
+template<class HW>
+void PDQ_GFX<HW>::GradientSpan::operator()(coord_t xa, coord_t xb, coord_t py)
+{
+	static const uint8_t bayer[16] PROGMEM =
+	{
+		 0,  8,  2, 10,
+		12,  4, 14,  6,
+		 3, 11,  1,  9,
+		15,  7, 13,  5
+	};
+
+	uint8_t	band = (py >= by0) && (py <= by1);	// full-width row
+	if (!band)
+		open = 0;
+	if (xa < 0)
+		xa = 0;
+	if (xb >= _width)
+		xb = _width - 1;
+	if ((xa > xb) || (py < 0) || (py >= _height))
+		return;
+
+	if (!open)
+	{
+		if (band)
+		{
+			HW::setAddrWindow(xa, py, xb, (by1 < _height) ? by1 : _height-1);
+			open = 1;
+		}
+		else
+		{
+			HW::setAddrWindow(xa, py, xb, py);
+		}
+	}
+
+	// per-row colors (vertical gradient only depends on row, plus dither column)
+	color_t		rowc[4];
+	const uint8_t *thr = &bayer[(py & 3) << 2];
+	if (kind == GRADIENT_VERTICAL)
+	{
+		uint16_t t = (h > 1) ? (uint16_t)(((int32_t)(py - y) << 8) / (h-1)) : 0;
+		for (uint8_t i = 0; i < 4; i++)
+			rowc[i] = dither ? blendColor(color1, color2, t, pgm_read_byte(&thr[i])) : (i ? rowc[0] : blendColor(color1, color2, t));
+	}
+
+	// radial distance tracking
+	coord_t		dy	= py - cy;
+	int32_t		d2	= (int32_t)(xa - cx) * (xa - cx) + (int32_t)dy * dy;
+	coord_t		d	= (xa > cx) ? xa - cx : cx - xa;
+	if (dy < 0)
+		d -= dy;
+	else
+		d += dy;
+	uint32_t	tf	= dt * (uint32_t)(xa - x);
+
+	color_t		runc = 0;
+	coord_t		runn = 0;
+	for (coord_t px = xa; px <= xb; px++)
+	{
+		color_t	c;
+		if (kind == GRADIENT_VERTICAL)
+		{
+			c = rowc[px & 3];
+		}
+		else
+		{
+			uint16_t t;
+			if (kind == GRADIENT_HORIZONTAL)
+			{
+				t = tf >> 8;
+				tf += dt;
+			}
+			else
+			{
+				while ((int32_t)d * d > d2)
+					d--;
+				while ((int32_t)(d+1) * (d+1) <= d2)
+					d++;
+				t = ((uint32_t)d * dt) >> 8;
+				if (t > 256)
+					t = 256;
+				d2 += 2*(px - cx) + 1;
+			}
+			c = blendColor(color1, color2, t, dither ? pgm_read_byte(&thr[px & 3]) : 8);
+		}
+		if (runn && (c == runc))
+		{
+			runn++;
+		}
+		else
+		{
+			if (runn)
+				HW::pushColor(runc, runn);
+			runc = c;
+			runn = 1;
+		}
+	}
+	HW::pushColor(runc, runn);
+}
+
+// Shade one horizontal span (clipped) in a single address window, runs of the same color
+// are pushed together
+template<class HW>
+template<class S>
+void PDQ_GFX<HW>::shadeSpan(coord_t x0, coord_t x1, coord_t y, S &shader)
+{
+	if ((y < 0) || (y >= _height))
+		return;
+	if (x0 < 0)
+		x0 = 0;
+	if (x1 >= _width)
+		x1 = _width - 1;
+	if (x0 > x1)
+		return;
+
+	HW::setAddrWindow(x0, y, x1, y);
+
+	color_t	runc = shader(x0, y);
+	coord_t	runn = 1;
+	for (coord_t x = x0+1; x <= x1; x++)
+	{
+		color_t	c = shader(x, y);
+		if (c == runc)
+		{
+			runn++;
+		}
+		else
+		{
+			HW::pushColor(runc, runn);
+			runc = c;
+			runn = 1;
+		}
+	}
+	HW::pushColor(runc, runn);
+}
+
+// Fill a rectangle using a shader (in a single address window, runs of the same color
+// pushed together, also across rows)
+template<class HW>
+template<class S>
+void PDQ_GFX<HW>::fillRectShader(coord_t x, coord_t y, coord_t w, coord_t h, S shader)
+{
+	if (x < 0)
+	{
+		w += x;
+		x = 0;
+	}
+	if (y < 0)
+	{
+		h += y;
+		y = 0;
+	}
+	if ((x + w) > _width)
+		w = _width - x;
+	if ((y + h) > _height)
+		h = _height - y;
+	if ((w <= 0) || (h <= 0))
+		return;
+
+	HW::setAddrWindow(x, y, x+w-1, y+h-1);
+
+	color_t	runc = 0;
+	coord_t	runn = 0;
+	for (coord_t j = y; j < y+h; j++)
+	{
+		for (coord_t i = x; i < x+w; i++)
+		{
+			color_t	c = shader(i, j);
+			if (runn && (c == runc) && (runn < 0x7FFF))
+			{
+				runn++;
+			}
+			else
+			{
+				if (runn)
+					HW::pushColor(runc, runn);
+				runc = c;
+				runn = 1;
+			}
+		}
+	}
+	HW::pushColor(runc, runn);
+}
+
+// Fill a rounded rectangle using a shader
+template<class HW>
+template<class S>
+void PDQ_GFX<HW>::fillRoundRectShader(coord_t x, coord_t y, coord_t w, coord_t h, coord_t r, S shader)
+{
+	ShaderSpan<S>	span = { shader };
+	roundRectSpans(x, y, w, h, r, span);
+}
+
+// Fill a circle using a shader
+template<class HW>
+template<class S>
+void PDQ_GFX<HW>::fillCircleShader(coord_t x0, coord_t y0, coord_t r, S shader)
+{
+	ShaderSpan<S>	span = { shader };
+	roundRectSpans(x0-r, y0-r, 2*r+1, 2*r+1, r, span);
+}
+
+// Scan convert a rounded rectangle (a circle when w == h == 2*r+1) into horizontal spans
+template<class HW>
+template<class SPAN>
+void PDQ_GFX<HW>::roundRectSpans(coord_t x, coord_t y, coord_t w, coord_t h, coord_t r, SPAN &span)
+{
+	if ((w <= 0) || (h <= 0))
+		return;
+	if (r < 0)
+		r = 0;
+	if (2*r > w)
+		r = w/2;
+	if (2*r > h)
+		r = h/2;
+
+	coord_t	hw = 0;		// half-width of corner row
+	coord_t	ylast = (y+h-1 < _height) ? y+h-1 : _height-1;
+
+	for (coord_t j = (y < 0) ? -y : 0; y+j <= ylast; j++)
+	{
+		coord_t	inset	= 0;
+		coord_t	ky		= (j < r) ? r - j : ((j > h-1-r) ? j - (h-1-r) : 0);
+
+		if (ky)
+		{
+			// half-width of radius r circle at ky rows from its centre
+			int32_t	t = (int32_t)r * r + r - (int32_t)ky * ky;
+			while ((int32_t)(hw+1) * (hw+1) <= t)
+				hw++;
+			while ((int32_t)hw * hw > t)
+				hw--;
+			inset = r - hw;
+		}
+		span(x + inset, x + w-1 - inset, y + j);
+	}
+}
+
+// Draw a 1-bit image (bitmap) at the specified (x, y) position from the
+// provided bitmap buffer (must be PROGMEM memory) using the specified
+// foreground color (unset bits are transparent).
+template<class HW>
+void PDQ_GFX<HW>::drawBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color)
+{
+	coord_t i, j, byteWidth = (w + 7) / 8;
+	uint8_t byte;
+
+	for (j = 0; j < h; j++)
+	{
+		for (i = 0; i < w; i++)
+		{
+			if (i % 8 == 0)
+				byte = pgm_read_byte(bitmap + j * byteWidth + i / 8);
+			else
+				byte <<= 1;
+
+			if (byte & 0x80)
+				HW::drawPixel(x+i, y+j, color);
+		}
+	}
+}
+
+// Draw a 1-bit image (bitmap) at the specified (x, y) position from the
+// provided bitmap buffer (must be PROGMEM memory) using the specified
+// foreground (for set bits) and background (for clear bits) colors.
+template<class HW>
+void PDQ_GFX<HW>::drawBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color, color_t bg)
+{
+	coord_t i, j, byteWidth = (w + 7) / 8;
 	uint8_t byte;
 
 	for (j = 0; j < h; j++)
@@ -715,61 +2194,108 @@ void PDQ_GFX<HW>::drawXBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord
 }
 
 template<class HW>
-size_t PDQ_GFX<HW>::write(uint8_t c)
+size_t PDQ_GFX<HW>::write(uint8_t b)
+{
+	return write(&b, 1);
+}
+
+// Write characters at the cursor.  Font state used for every character (line height, glyph
+// table, colors) is read once per buffer, and glyphs are drawn without looking them up again.
+template<class HW>
+size_t PDQ_GFX<HW>::write(const uint8_t *buffer, size_t size)
 {
+	const uint8_t	*end = buffer + size;
+
 	// 'Classic' built-in font
 	if (!gfxFont)
 	{
-		if (c == '\n')
-		{
-			cursor_x = 0;
-			cursor_y += (coord_t)textsize*8;
-		}
-		else if (c != '\r')
+		coord_t	cw	= (coord_t)textsize*6;
+		coord_t	lh	= (coord_t)textsize*8;
+
+		while (buffer < end)
 		{
-			HW::drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
-			cursor_x += textsize*6;
-			if (wrap && (cursor_x > (_width - textsize*6)))
+			uint8_t c = *buffer++;
+			if (c == '\n')
 			{
 				cursor_x = 0;
-				cursor_y += textsize*8;
+				cursor_y += lh;
+			}
+			else if (c != '\r')
+			{
+				HW::drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+				cursor_x += cw;
+				if (wrap && (cursor_x > (_width - cw)))
+				{
+					cursor_x = 0;
+					cursor_y += lh;
+				}
 			}
 		}
+		return size;
 	}
-	else
+
+	coord_t		lh		= (coord_t)textsize * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+	GFXglyph	*glyphs	= (GFXglyph *)pgm_read_pointer(&gfxFont->glyph);
+	uint8_t		opaque	= (textbgcolor != textcolor);
+
+	while (buffer < end)
 	{
-		if(c == '\n')
+		uint8_t		b	= *buffer++;
+		uint16_t	c	= b;
+
+		// Unicode fonts are written UTF-8 encoded (collect bytes until character is complete)
+		if (gfxRanges && !(b & 0x80))
+		{
+			utf8Left = 0;				// ASCII ends any unfinished sequence
+		}
+		else if (gfxRanges)
+		{
+			if ((b & 0xC0) != 0x80)		// lead byte
+			{
+				utf8Left = (b >= 0xE0) ? ((b >= 0xF0) ? 3 : 2) : 1;
+				utf8Char = (b >= 0xF0) ? 0xFFFF : (b & (0x3F >> utf8Left));	// (no characters past 0xFFFF)
+				continue;
+			}
+			if (!utf8Left)				// stray continuation byte
+				continue;
+			if (utf8Char != 0xFFFF)
+				utf8Char = (utf8Char << 6) | (b & 0x3F);
+			if (--utf8Left)
+				continue;
+			c = utf8Char;
+		}
+
+		uint16_t gi;
+		if (c == '\n')
 		{
 			cursor_x	= 0;
-			cursor_y += (coord_t)textsize * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+			cursor_y	+= lh;
+			lastChar	= 0;
 		}
-		else if (c != '\r')
+		else if ((c != '\r') && ((gi = glyphIndex(c)) != 0xFFFF))
 		{
-			uint8_t first = pgm_read_byte(&gfxFont->first);
-			if ((c >= first) && (c <= (uint8_t)pgm_read_byte(&gfxFont->last)))
+			cursor_x += kerning(lastChar, c);
+			lastChar = c;
+			GFXglyph *glyph = &glyphs[gi];
+			uint8_t	w		= pgm_read_byte(&glyph->width);
+			uint8_t	h		= pgm_read_byte(&glyph->height);
+			// Is there an associated bitmap? (or an opaque cell to draw)
+			if (((w > 0) && (h > 0)) || opaque)
 			{
-				uint8_t	c2		= c - pgm_read_byte(&gfxFont->first);
-				GFXglyph *glyph = &(((GFXglyph *)pgm_read_pointer(&gfxFont->glyph))[c2]);
-				uint8_t	w		= pgm_read_byte(&glyph->width);
-				uint8_t	h		= pgm_read_byte(&glyph->height);
-				// Is there an associated bitmap?
-				if ((w > 0) && (h > 0))
+				coord_t xo = (int8_t)pgm_read_byte(&glyph->xOffset); // sic
+				if (wrap && ((cursor_x + textsize * (xo + w)) >= _width))
 				{
-					coord_t xo = (int8_t)pgm_read_byte(&glyph->xOffset); // sic
-					if(wrap && ((cursor_x + textsize * (xo + w)) >= _width))
-					{
-						// Drawing character would go off right edge; wrap to new line
-						cursor_x	= 0;
-						cursor_y += (coord_t)textsize *
-						(uint8_t)pgm_read_byte(&gfxFont->yAdvance);
-					}
-					HW::drawCharGFX(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+					// Drawing character would go off right edge; wrap to new line
+					cursor_x	= 0;
+					cursor_y	+= lh;
+					lastChar	= 0;
 				}
-				cursor_x += pgm_read_byte(&glyph->xAdvance) * (coord_t)textsize;
+				drawGlyphGFX(cursor_x, cursor_y, glyph, textcolor, textbgcolor, textsize);
 			}
+			cursor_x += pgm_read_byte(&glyph->xAdvance) * (coord_t)textsize;
 		}
 	}
-	return 1;
+	return size;
 }
 
 // Draw a character with built-in font
@@ -782,66 +2308,182 @@ void PDQ_GFX<HW>::drawChar(coord_t x, coord_t y, unsigned char c, color_t color,
     ((y + (8 * size) - 1) < 0))
     return;
 
-  uint8_t is_opaque = (bg != color);
-
   if(!_cp437 && (c >= 176))	// Handle 'classic' charset behavior
     c++;
 
-  for (int8_t i=0; i<6; i++)
+  // transpose the font's column bytes into rows (MSB is left column)
+  uint8_t	rows[8];
+  memset(rows, 0, sizeof(rows));
+  for (int8_t i=0; i<5; i++)
   {
-    uint8_t line;
+    uint8_t line = pgm_read_byte(glcdfont+(c*5)+i);
+    for (int8_t j = 0; j < 8; j++, line >>= 1)
+    {
+      if (line & 0x1)
+        rows[j] |= 0x80 >> i;
+    }
+  }
 
-    if (i == 5)
-      line = 0x0;
-    else
-      line = pgm_read_byte(glcdfont+(c*5)+i);
+  // Smoothed: upscale 2x, 3x or 4x (2x twice) with edge rules, then block scale any remainder
+  if (smooth && (size > 1))
+  {
+    uint8_t	scale = (size % 4 == 0) ? 4 : (size % 3 == 0) ? 3 : (size % 2 == 0) ? 2 : 0;
+    if (scale)
+    {
+      uint8_t	big[32*3];		// up to 24x32
+      uint8_t	stride = (6*scale + 7) >> 3;
+      if (scale == 4)
+      {
+        uint8_t	mid[16*2];	// 12x16
+        scaleBits(rows, 1, 6, 8, mid, 2, 2);
+        scaleBits(mid, 2, 12, 16, big, stride, 2);
+      }
+      else
+        scaleBits(rows, 1, 6, 8, big, stride, scale);
+      drawBitRows(x, y, big, stride, 6*scale, 8*scale, size/scale, color, bg);
+      return;
+    }
+  }
+
+  drawBitRows(x, y, rows, 1, 6, 8, size, color, bg);
+}
 
-    if (size == 1)
+// Draw a bitmap of bit rows (MSB first, stride bytes per row) scaled by size.  When opaque
+// (bg != color) it is streamed through one clipped address window merging runs of the same
+// color, otherwise runs of set pixels are drawn with identical consecutive rows merged.
+template<class HW>
+void PDQ_GFX<HW>::drawBitRows(coord_t x, coord_t y, const uint8_t *rows, uint8_t stride, uint8_t w, uint8_t h, uint8_t size, color_t color, color_t bg)
+{
+  if (bg != color)
+  {
+    coord_t	x0 = (x < 0) ? 0 : x;
+    coord_t	y0 = (y < 0) ? 0 : y;
+    coord_t	x1 = x + (coord_t)w*size - 1;
+    coord_t	y1 = y + (coord_t)h*size - 1;
+    if (x1 >= _width)
+      x1 = _width-1;
+    if (y1 >= _height)
+      y1 = _height-1;
+    if ((x0 > x1) || (y0 > y1))
+      return;
+
+    uint8_t	i0 = (x0 - x) / size;		// first column and sub-pixel
+    uint8_t	si0 = (x0 - x) - i0*size;
+    uint8_t	j = (y0 - y) / size;		// current row and sub-pixel
+    uint8_t	sj = (y0 - y) - j*size;
+
+    HW::setAddrWindow(x0, y0, x1, y1);
+    for (coord_t py = y0; py <= y1; py++)
     {
-      for (int8_t j = 0; j < 8; j++)
+      const uint8_t *row = rows + j*stride;
+      uint8_t	i = i0;
+      uint8_t	si = si0;
+      color_t	rc = (row[i >> 3] & (0x80 >> (i & 7))) ? color : bg;
+      coord_t	n = 0;
+      for (coord_t px = x0; px <= x1; px++)
       {
-        if (line & 0x1)
+        color_t pc = (row[i >> 3] & (0x80 >> (i & 7))) ? color : bg;
+        if (pc != rc)
         {
-          HW::drawPixel(x+i, y+j, color);
+          HW::pushColor(rc, n);
+          rc = pc;
+          n = 0;
         }
-        else if (is_opaque)
+        n++;
+        if (++si == size)
         {
-          HW::drawPixel(x+i, y+j, bg);
+          si = 0;
+          i++;
         }
-        line >>= 1;
+      }
+      HW::pushColor(rc, n);
+      if (++sj == size)
+      {
+        sj = 0;
+        j++;
       }
     }
-    else
+  }
+  else
+  {
+    for (uint8_t j = 0; j < h; )
     {
-      for (int8_t j = 0; j < 8; j++)
+      uint8_t k = j+1;
+      while ((k < h) && !memcmp(rows + k*stride, rows + j*stride, stride))
+        k++;
+      drawGlyphRow(rows + j*stride, w, x, y + (coord_t)j*size, size, (coord_t)(k-j)*size, color);
+      j = k;
+    }
+  }
+}
+
+// Upscale a bit row bitmap 2x (Scale2x/EPX) or 3x (Scale3x), rounding diagonal edges instead of
+// making blocks.  Pixels outside the source are treated as clear.
+template<class HW>
+void PDQ_GFX<HW>::scaleBits(const uint8_t *src, uint8_t sstride, uint8_t w, uint8_t h, uint8_t *dst, uint8_t dstride, uint8_t scale)
+{
+#define SRC(X, Y)	((uint8_t)(X) < w && (uint8_t)(Y) < h && (src[(uint8_t)(Y)*sstride + ((uint8_t)(X) >> 3)] & (0x80 >> ((X) & 7))))
+  memset(dst, 0, h*scale*dstride);
+  for (uint8_t y = 0; y < h; y++)
+  {
+    for (uint8_t x = 0; x < w; x++)
+    {
+      // 3x3 neighborhood (A B C / D E F / G H I), using 0xFF wraparound as "outside"
+      uint8_t	A = SRC(x-1, y-1) != 0, B = SRC(x, y-1) != 0, C = SRC(x+1, y-1) != 0;
+      uint8_t	D = SRC(x-1, y) != 0,   E = SRC(x, y) != 0,   F = SRC(x+1, y) != 0;
+      uint8_t	G = SRC(x-1, y+1) != 0, H = SRC(x, y+1) != 0, I = SRC(x+1, y+1) != 0;
+      uint8_t	out[9];
+      if (scale == 2)
       {
-        if (line & 0x1)
-        {
-          HW::fillRect(x+(i*size), y+(j*size), size, size, color);
-        }
-        else if (is_opaque)
+        out[0] = (D == B && D != H && B != F) ? D : E;
+        out[1] = (B == F && B != D && F != H) ? F : E;
+        out[2] = (D == H && D != B && H != F) ? D : E;
+        out[3] = (H == F && D != H && B != F) ? F : E;
+      }
+      else
+      {
+        out[0] = (D == B && B != F && D != H) ? D : E;
+        out[1] = ((D == B && B != F && D != H && E != C) || (B == F && B != D && F != H && E != A)) ? B : E;
+        out[2] = (B == F && B != D && F != H) ? F : E;
+        out[3] = ((D == B && B != F && D != H && E != G) || (D == H && D != B && H != F && E != A)) ? D : E;
+        out[4] = E;
+        out[5] = ((B == F && B != D && F != H && E != I) || (H == F && D != H && B != F && E != C)) ? F : E;
+        out[6] = (D == H && D != B && H != F) ? D : E;
+        out[7] = ((D == H && D != B && H != F && E != I) || (H == F && D != H && B != F && E != G)) ? H : E;
+        out[8] = (H == F && D != H && B != F) ? F : E;
+      }
+      for (uint8_t j = 0; j < scale; j++)
+      {
+        uint8_t *row = dst + (y*scale + j)*dstride;
+        for (uint8_t i = 0; i < scale; i++)
         {
-          HW::fillRect(x+(i*size), y+(j*size), size, size, bg);
+          uint8_t	dx = x*scale + i;
+          if (out[j*scale + i])
+            row[dx >> 3] |= 0x80 >> (dx & 7);
         }
-        line >>= 1;
       }
     }
   }
+#undef SRC
 }
 
 // Draw a character with GFX font
 template<class HW>
-void PDQ_GFX<HW>::drawCharGFX(coord_t x, coord_t y, unsigned char c, color_t color, color_t bg, uint8_t size)
+void PDQ_GFX<HW>::drawCharGFX(coord_t x, coord_t y, uint16_t c, color_t color, color_t bg, uint8_t size)
 {
   // Character is assumed previously filtered by write() to eliminate
   // newlines, returns, non-printable characters, etc.	Calling drawChar()
   // directly with 'bad' characters of font may cause mayhem!
 
-  c -= pgm_read_byte(&gfxFont->first);
-  GFXglyph *glyph	= &(((GFXglyph *)pgm_read_pointer(&gfxFont->glyph))[c]);
-  uint8_t	*bitmap = (uint8_t *)pgm_read_pointer(&gfxFont->bitmap);
+  uint16_t gi = glyphIndex(c);
+  if (gi != 0xFFFF)
+    drawGlyphGFX(x, y, &(((GFXglyph *)pgm_read_pointer(&gfxFont->glyph))[gi]), color, bg, size);
+}
 
-  uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
+// Draw a glyph of the current GFX font
+template<class HW>
+void PDQ_GFX<HW>::drawGlyphGFX(coord_t x, coord_t y, GFXglyph *glyph, color_t color, color_t bg, uint8_t size)
+{
   uint8_t	w	= pgm_read_byte(&glyph->width);
   uint8_t	h	= pgm_read_byte(&glyph->height);
   // uint8_t	xa	= pgm_read_byte(&glyph->xAdvance);
@@ -850,117 +2492,340 @@ void PDQ_GFX<HW>::drawCharGFX(coord_t x, coord_t y, unsigned char c, color_t col
 
   // Todo: Add character clipping here
 
-  // NOTE: THERE IS NO 'BACKGROUND' COLOR OPTION ON CUSTOM FONTS.
-  // THIS IS ON PURPOSE AND BY DESIGN.  The background color feature
-  // has typically been used with the 'classic' font to overwrite old
-  // screen contents with new data.  This ONLY works because the
-  // characters are a uniform size; it's not a sensible thing to do with
-  // proportionally-spaced fonts with glyphs of varying sizes (and that
-  // may overlap).  To replace previously-drawn text when using a custom
-  // font, use the getTextBounds() function to determine the smallest
-  // rectangle encompassing a string, erase the area with fillRect(),
-  // then draw new text.  This WILL infortunately 'blink' the text, but
-  // is unavoidable.  Drawing 'background' pixels will NOT fix this,
-  // only creates a new set of problems.  Have an idea to work around
-  // this (a canvas object type for MCUs that can afford the RAM and
-  // displays supporting setAddrWindow() and pushColors()), but haven't
-  // implemented this yet.
-
-  if (bo & 0x8000) {
-    // packed font
-    uint8_t	bits_cnt = 0;
-    uint8_t	bits;
-    uint8_t	cnt,cnt2;
-    bo &= 0x7FFF;
-    coord_t _y = y+yo;
-    for (coord_t yy=0; yy<h; yy++, _y++)
+  // With a background color each character fills its whole cell (xAdvance wide, yAdvance high)
+  // in one address window, so text can be overwritten in place without erasing it first (and
+  // without flicker).  Pixels of neighboring glyphs that overhang into the cell are erased.
+  // Anti-aliased fonts blend their edges into the background color this way; without one
+  // (as the display can't be read back) they are drawn at 1 bit, like other fonts.
+  if (bg != color)
+  {
+    if (gfxGray)
+      drawCharGFXGray(x, y, glyph, color, bg, size);
+    else
+      drawCharGFXOpaque(x, y, glyph, color, bg, size);
+    return;
+  }
+
+  coord_t	gx		= x + (coord_t)xo * size;
+  coord_t	gy		= y + (coord_t)yo * size;
+  GlyphBits	gb(glyph);
+
+  // Transparent row span glyphs: spans are drawn as they are (as tall as the rows they repeat
+  // over), no bits to decode
+  if (gfxSpans)
+  {
+    fontaddr_t	p	= gb.p;
+    uint8_t		sy	= pgm_read_font_byte(p++);
+    while (sy != 0xFF)
     {
-      coord_t _x = x+xo;
-      for (coord_t xx=0; xx<w; xx+=cnt2)
+      uint8_t		n	= pgm_read_font_byte(p++);
+      fontaddr_t	q	= p;
+      p += 2 * n;
+      uint8_t		ny	= pgm_read_font_byte(p++);
+      coord_t		sh	= (coord_t)(((ny == 0xFF) ? h : ny) - sy) * size;
+      while (n--)
       {
+        uint8_t	sx	= pgm_read_font_byte(q++);
+        uint8_t	sw	= pgm_read_font_byte(q++);
+        if (sh == 1)
+          HW::drawFastHLine(gx + sx, gy + sy, sw, color);
+        else
+          HW::fillRect(gx + (coord_t)sx * size, gy + (coord_t)sy * size, (coord_t)sw * size, sh, color);
+      }
+      sy = ny;
+    }
+    return;
+  }
 
-        if (bits_cnt == 0)
-        {
-          bits = pgm_read_byte(&bitmap[bo++]);
-          bits_cnt = 2;
-          cnt = (bits & 0x7)+1;
-        }
+  // Transparent: decode each glyph row (packed or unpacked) and draw its runs of set pixels,
+  // merging identical consecutive rows into taller rectangles.
+  uint8_t	rowbits[2][32];
+  uint8_t	cur		= 0;
+  uint8_t	bytes	= (w + 7) >> 3;
+  uint8_t	rows	= 0;		// identical rows pending in rowbits[cur^1]
+
+  for (uint8_t yy = 0; yy < h; yy++)
+  {
+    gb.row(rowbits[cur], w);
+    if (rows && !memcmp(rowbits[cur], rowbits[cur^1], bytes))
+    {
+      rows++;
+      continue;
+    }
+    if (rows)
+    {
+      drawGlyphRow(rowbits[cur^1], w, gx, gy, size, (coord_t)rows*size, color);
+      gy += (coord_t)rows*size;
+    }
+    rows = 1;
+    cur ^= 1;
+  }
+  if (rows)
+    drawGlyphRow(rowbits[cur^1], w, gx, gy, size, (coord_t)rows*size, color);
+}
+
+// Draw the runs of set pixels in a glyph row (MSB first) as rectangles (size scaled, h high)
+template<class HW>
+void PDQ_GFX<HW>::drawGlyphRow(const uint8_t *bits, uint8_t w, coord_t x, coord_t y, uint8_t size, coord_t h, color_t color)
+{
+	for (uint8_t i = 0; i < w; )
+	{
+		if (!(bits[i >> 3] & (0x80 >> (i & 7))))
+		{
+			i++;
+			continue;
+		}
+		uint8_t start = i;
+		while ((++i < w) && (bits[i >> 3] & (0x80 >> (i & 7))))
+			;
+		HW::fillRect(x + (coord_t)start * size, y, (coord_t)(i - start) * size, h, color);
+	}
+}
+
+// Draw an anti-aliased GFX font character cell with opaque background.  Like drawCharGFXOpaque()
+// the cell is streamed through one address window, each coverage level taking its color from
+// a ramp between bg and color (computed only when the colors change).  Glyph rows are decoded
+// pixel by pixel straight from the RLE data (restarted from the row's beginning for size > 1).
+template<class HW>
+void PDQ_GFX<HW>::drawCharGFXGray(coord_t x, coord_t y, GFXglyph *glyph, color_t color, color_t bg, uint8_t size)
+{
+	uint8_t		w		= pgm_read_byte(&glyph->width);
+	uint8_t		h		= pgm_read_byte(&glyph->height);
+	uint8_t		xa		= pgm_read_byte(&glyph->xAdvance);
+	int8_t		xo		= pgm_read_byte(&glyph->xOffset);
+	int8_t		yo		= pgm_read_byte(&glyph->yOffset);
+
+	if ((color != grayColor) || (bg != grayBg) || (gfxGrayMax != grayMax))
+	{
+		for (uint8_t i = 0; i <= gfxGrayMax; i++)
+			grayRamp[i] = blendColor(bg, color, ((uint16_t)i << 8) / gfxGrayMax);
+		grayColor	= color;
+		grayBg		= bg;
+		grayMax		= gfxGrayMax;
+	}
+
+	// cell and glyph box (inclusive)
+	coord_t	cx0	= x;
+	coord_t	cy0	= y - (coord_t)gfxAscent * size;
+	coord_t	cx1	= cx0 + (coord_t)xa * size - 1;
+	coord_t	cy1	= cy0 + (coord_t)pgm_read_byte(&gfxFont->yAdvance) * size - 1;
+	coord_t	gx0	= x + (coord_t)xo * size;
+	coord_t	gy0	= y + (coord_t)yo * size;
+	coord_t	gx1	= gx0 + (coord_t)w * size - 1;
+	coord_t	gy1	= gy0 + (coord_t)h * size - 1;
+
+	// window is cell clipped to screen
+	coord_t	wx0	= (cx0 < 0) ? 0 : cx0;
+	coord_t	wy0	= (cy0 < 0) ? 0 : cy0;
+	coord_t	wx1	= (cx1 >= _width) ? _width-1 : cx1;
+	coord_t	wy1	= (cy1 >= _height) ? _height-1 : cy1;
+
+	if ((wx0 <= wx1) && (wy0 <= wy1))
+	{
+		GlyphBits	gb(glyph);	// at start of glyph row gy
+		coord_t		gy = 0;
+
+		HW::setAddrWindow(wx0, wy0, wx1, wy1);
+		for (coord_t py = wy0; py <= wy1; py++)
+		{
+			if ((py < gy0) || (py > gy1) || (wx1 < gx0) || (wx0 > gx1))
+			{
+				HW::pushColor(bg, wx1-wx0+1);
+				continue;
+			}
+
+			coord_t want = (py - gy0) / size;
+			for (; gy < want; gy++)
+				gb.skip(w);
+
+			// stream row, merging runs of the same color
+			GlyphBits	rb		= gb;
+			coord_t		d		= wx0 - gx0;	// scaled x position in glyph
+			uint8_t		gx		= 0;
+			uint8_t		sub		= 0;
+			uint8_t		lv		= 0;
+			if (d > 0)
+			{
+				gx	= d / size;
+				sub	= d - gx * size;
+				if (gx < w)
+				{
+					rb.skip(gx);
+					if (sub)	// (partly clipped scaled pixel)
+						lv = rb.next();
+				}
+			}
+			color_t	rc	= bg;
+			coord_t	n	= 0;
+			for (coord_t px = wx0; px <= wx1; px++, d++)
+			{
+				color_t c = bg;
+				if ((d >= 0) && (gx < w))
+				{
+					if (sub == 0)
+						lv = rb.next();
+					c = grayRamp[lv];
+					if (++sub == size)
+					{
+						sub = 0;
+						gx++;
+					}
+				}
+				if ((c != rc) && n)
+				{
+					HW::pushColor(rc, n);
+					n = 0;
+				}
+				rc = c;
+				n++;
+			}
+			HW::pushColor(rc, n);
+		}
+	}
+
+	// overhanging glyph pixels outside of the cell (blended with bg)
+	if ((w > 0) && ((gx0 < cx0) || (gx1 > cx1) || (gy0 < cy0) || (gy1 > cy1)))
+	{
+		GlyphBits	gb(glyph);
+		coord_t		py = gy0;
+
+		for (uint8_t gy = 0; gy < h; gy++, py += size)
+		{
+			coord_t	px = gx0;
+			for (uint8_t gx = 0; gx < w; gx++, px += size)
+			{
+				uint8_t lv = gb.next();
+				if (lv && ((px < cx0) || (px > cx1) || (py < cy0) || (py > cy1)))
+					HW::fillRect(px, py, size, size, grayRamp[lv]);
+			}
+		}
+	}
+}
+
+// Draw a GFX font character cell with opaque background.  The cell is streamed row by row
+// through one address window (glyph rows are decoded once and reused for size > 1), then any
+// glyph pixels overhanging the cell are drawn on top.
+template<class HW>
+void PDQ_GFX<HW>::drawCharGFXOpaque(coord_t x, coord_t y, GFXglyph *glyph, color_t color, color_t bg, uint8_t size)
+{
+	uint8_t		w		= pgm_read_byte(&glyph->width);
+	uint8_t		h		= pgm_read_byte(&glyph->height);
+	uint8_t		xa		= pgm_read_byte(&glyph->xAdvance);
+	int8_t		xo		= pgm_read_byte(&glyph->xOffset);
+	int8_t		yo		= pgm_read_byte(&glyph->yOffset);
+	uint8_t		rowbits[32];
+
+	// cell and glyph box (inclusive)
+	coord_t	cx0	= x;
+	coord_t	cy0	= y - (coord_t)gfxAscent * size;
+	coord_t	cx1	= cx0 + (coord_t)xa * size - 1;
+	coord_t	cy1	= cy0 + (coord_t)pgm_read_byte(&gfxFont->yAdvance) * size - 1;
+	coord_t	gx0	= x + (coord_t)xo * size;
+	coord_t	gy0	= y + (coord_t)yo * size;
+	coord_t	gx1	= gx0 + (coord_t)w * size - 1;
+	coord_t	gy1	= gy0 + (coord_t)h * size - 1;
+
+	// window is cell clipped to screen
+	coord_t	wx0	= (cx0 < 0) ? 0 : cx0;
+	coord_t	wy0	= (cy0 < 0) ? 0 : cy0;
+	coord_t	wx1	= (cx1 >= _width) ? _width-1 : cx1;
+	coord_t	wy1	= (cy1 >= _height) ? _height-1 : cy1;
+
+	if ((wx0 <= wx1) && (wy0 <= wy1))
+	{
+		GlyphBits	gb(glyph);
+		coord_t		gy = -1;	// glyph row currently in rowbits
+
+		HW::setAddrWindow(wx0, wy0, wx1, wy1);
+		for (coord_t py = wy0; py <= wy1; py++)
+		{
+			if ((py < gy0) || (py > gy1) || (wx1 < gx0) || (wx0 > gx1))
+			{
+				HW::pushColor(bg, wx1-wx0+1);
+				continue;
+			}
+
+			coord_t want = (py - gy0) / size;
+			while (gy < want)
+			{
+				gb.row(rowbits, w);
+				gy++;
+			}
+
+			// stream row, merging runs of the same color
+			coord_t	d	= wx0 - gx0;	// scaled x position in glyph
+			uint8_t	gx	= 0;
+			uint8_t	sub	= 0;
+			if (d > 0)
+			{
+				gx	= d / size;
+				sub	= d - gx * size;
+			}
+			color_t	rc	= bg;
+			coord_t	n	= 0;
+			for (coord_t px = wx0; px <= wx1; px++, d++)
+			{
+				color_t c = bg;
+				if ((d >= 0) && (gx < w))
+				{
+					if (rowbits[gx >> 3] & (0x80 >> (gx & 7)))
+						c = color;
+					if (++sub == size)
+					{
+						sub = 0;
+						gx++;
+					}
+				}
+				if ((c != rc) && n)
+				{
+					HW::pushColor(rc, n);
+					n = 0;
+				}
+				rc = c;
+				n++;
+			}
+			HW::pushColor(rc, n);
+		}
+	}
 
-        if (xx+cnt >= w)
-        {
-            cnt2 = w-xx;
-        } else {
-            cnt2 = cnt;
-        }
+	// overhanging glyph pixels outside of the cell (transparent)
+	if ((w > 0) && ((gx0 < cx0) || (gx1 > cx1) || (gy0 < cy0) || (gy1 > cy1)))
+	{
+		GlyphBits	gb(glyph);
+		coord_t		py = gy0;
 
-        if (bits & 0x8)
-        {
-          if (size == 1)
-          {
-            HW::drawFastHLine(_x, _y, cnt2, color);
-            _x += cnt2;
-          }
-          else
-          {
-            HW::fillRect(x+xo+xx*size, y+yo+yy*size, cnt2*size, size, color);
-            // _x not used if size > 1, so not need to increment it
-          }
-        } else {
-          _x += cnt2;
-        }
+		for (uint8_t gy = 0; gy < h; gy++, py += size)
+		{
+			uint8_t	inside = (py >= cy0) && (py <= cy1);
 
-        cnt -= cnt2;
-        if (cnt == 0) {
-          bits >>= 4;
-          cnt = (bits & 0x7)+1;
-          bits_cnt--;
-        }
-      }
-    }
-  } else {
-    uint8_t	bit = 0;
-    uint8_t	bits = 0;
-    if (size == 1)
-    {
-      coord_t _y = y+yo;
-      for (coord_t yy=0; yy<h; yy++, _y++)
-      {
-        coord_t _x = x+xo;
-        for (coord_t xx=0; xx<w; xx++, _x++)
-        {
-          if (bit == 0)
-          {
-            bits = pgm_read_byte(&bitmap[bo++]);
-          }
-          bit = (bit+1) & 0x7;
-
-          if (bits & 0x80)
-          {
-            HW::drawPixel(_x, _y, color);
-          }
-          bits <<= 1;
-        }
-      }
-    } else {
-      for (coord_t yy=0; yy<h; yy++)
-      {
-        for (coord_t xx=0; xx<w; xx++)
-        {
-          if (bit == 0)
-          {
-            bits = pgm_read_byte(&bitmap[bo++]);
-          }
-          bit = (bit+1) & 0x7;
-
-          if (bits & 0x80)
-          {
-            HW::fillRect(x+xo+xx*size, y+yo+yy*size, size, size, color);
-          }
-          bits <<= 1;
-        }
-      }
-    }
-  }
+			gb.row(rowbits, w);
+			if (inside && (gx0 >= cx0) && (gx1 <= cx1))
+				continue;
+			for (uint8_t gx = 0; gx < w; )
+			{
+				if (!(rowbits[gx >> 3] & (0x80 >> (gx & 7))))
+				{
+					gx++;
+					continue;
+				}
+				uint8_t	start = gx;
+				while ((gx < w) && (rowbits[gx >> 3] & (0x80 >> (gx & 7))))
+					gx++;
+
+				coord_t	a = gx0 + (coord_t)start * size;
+				coord_t	b = gx0 + (coord_t)gx * size - 1;
+				if (!inside)
+					HW::fillRect(a, py, b-a+1, size, color);
+				else
+				{
+					if (a < cx0)
+						HW::fillRect(a, py, ((b < cx0) ? b : cx0-1)-a+1, size, color);
+					if (b > cx1)
+						HW::fillRect((a > cx1) ? a : cx1+1, py, b-((a > cx1) ? a : cx1+1)+1, size, color);
+				}
+			}
+		}
+	}
 }
 
 template<class HW>
@@ -968,6 +2833,7 @@ void PDQ_GFX<HW>::setCursor(coord_t x, coord_t y)
 {
 	cursor_x = (int16_t)x;
 	cursor_y = (int16_t)y;
+	lastChar = 0;
 }
 
 template<class HW>
@@ -998,6 +2864,12 @@ void PDQ_GFX<HW>::setTextWrap(boolean w)
 	wrap = w;
 }
 
+template<class HW>
+void PDQ_GFX<HW>::setTextSmooth(boolean s)
+{
+	smooth = s;
+}
+
 template<class HW>
 void PDQ_GFX<HW>::setRotation(uint8_t x)
 {
@@ -1023,8 +2895,25 @@ void PDQ_GFX<HW>::cp437(boolean x)
 	_cp437 = x;
 }
 
+// Set font (or NULL for the classic 5x7 font).  Far fonts (large fonts on AVRs over 64KB flash)
+// have no bitmap pointer and must be selected with the setFont below, here they fall back to
+// the classic font so the mistake shows on screen.
 template<class HW>
 void PDQ_GFX<HW>::setFont(const GFXfont *f)
+{
+	fontaddr_t	bitmap = f ? (fontaddr_t)(uintptr_t)pgm_read_pointer(&f->bitmap) : 0;
+
+	if (!bitmap)
+		f = NULL;
+	setFont(f, bitmap);
+}
+
+// Set font whose bitmaps are at a far flash address.  Large fonts generated by fontconvert
+// keep their bitmaps in GFX_FAR_PROGMEM, which on AVRs with over 64KB of flash is above the
+// reach of the 16-bit bitmap pointer in GFXfont, e.g.:
+//   tft.setFont(&FreeSans72pt7b, GFX_FAR_ADDRESS(FreeSans72pt7bBitmaps));
+template<class HW>
+void PDQ_GFX<HW>::setFont(const GFXfont *f, fontaddr_t bitmap)
 {
 	if (f)		// Font struct pointer passed in?
 	{
@@ -1042,13 +2931,100 @@ void PDQ_GFX<HW>::setFont(const GFXfont *f)
 		cursor_y -= 6;
 	}
 	gfxFont = (GFXfont *)f;
+
+	// cache font metrics (from the font's metrics table if it has one, else scan the glyphs)
+	gfxAscent	= 0;
+	gfxDescent	= 0;
+	gfxFixed	= 0;
+	gfxSpans	= 0;
+	gfxGray		= 0;
+	gfxHuffman	= 0;
+	gfxAdvance	= NULL;
+	gfxKernIndex = NULL;
+	gfxRanges	= NULL;
+	gfxBitmap	= bitmap;
+	gfxBitmapHigh = NULL;
+	lastChar	= 0;
+	utf8Left	= 0;
+	if (gfxFont)
+	{
+		gfxFirst	= pgm_read_byte(&gfxFont->first);
+		gfxLast		= pgm_read_byte(&gfxFont->last);
+		gfxGlyphs	= gfxLast - gfxFirst + 1;
+
+		gfxBitmapHigh = (uint8_t *)pgm_read_pointer(&gfxFont->bitmapHigh);
+		gfxRanges = (GFXrange *)pgm_read_pointer(&gfxFont->ranges);
+		if (gfxRanges)
+		{
+			gfxRangeCount	= 0;
+			gfxGlyphs		= 0;
+			for (GFXrange *r = gfxRanges; pgm_read_word(&r->first) <= pgm_read_word(&r->last); r++)
+			{
+				gfxRangeCount++;
+				gfxGlyphs += pgm_read_word(&r->last) - pgm_read_word(&r->first) + 1;
+			}
+		}
+
+		GFXkerning *kern = (GFXkerning *)pgm_read_pointer(&gfxFont->kerning);
+		if (kern)
+		{
+			gfxKernIndex = (uint16_t *)pgm_read_pointer(&kern->index);
+			gfxKernPairs = (GFXkernPair *)pgm_read_pointer(&kern->pairs);
+		}
+
+		GFXmetrics *metrics = (GFXmetrics *)pgm_read_pointer(&gfxFont->metrics);
+		if (metrics)
+		{
+			gfxAscent	= pgm_read_byte(&metrics->ascent);
+			gfxDescent	= pgm_read_byte(&metrics->descent);
+			gfxSpans	= pgm_read_byte(&metrics->flags) & GFX_ROW_SPANS;
+			gfxHuffman	= pgm_read_byte(&metrics->flags) & GFX_HUFFMAN;
+			if (pgm_read_byte(&metrics->flags) & (GFX_GRAY2 | GFX_GRAY4))
+			{
+				gfxGray		= (pgm_read_byte(&metrics->flags) & GFX_GRAY4) ? 4 : 2;
+				gfxGrayMax	= (1 << gfxGray) - 1;
+			}
+			if (pgm_read_byte(&metrics->flags) & GFX_FIXED_WIDTH)
+				gfxFixed = pgm_read_byte(&metrics->xAdvance);
+			else
+				gfxAdvance = (uint8_t *)pgm_read_pointer(&metrics->advance);
+		}
+		else
+		{
+			GFXglyph *glyph = (GFXglyph *)pgm_read_pointer(&gfxFont->glyph);
+			gfxFixed = pgm_read_byte(&glyph->xAdvance);
+			for (uint16_t i = 0; i < gfxGlyphs; i++, glyph++)
+			{
+				int8_t	yo = pgm_read_byte(&glyph->yOffset);
+				int8_t	yb = yo + (int8_t)pgm_read_byte(&glyph->height) - 1;
+				if (-yo > gfxAscent)
+					gfxAscent = -yo;
+				if (yb > gfxDescent)
+					gfxDescent = yb;
+				if (pgm_read_byte(&glyph->xAdvance) != gfxFixed)
+					gfxFixed = 0;
+			}
+		}
+	}
 }
 
-// Pass string and a cursor position, returns UL corner and W,H.
+// Forget all glyphs in the RAM glyph cache (PDQ_GLYPH_CACHE).  Glyphs are cached by font and
+// glyph index, so this is only needed when a font in RAM is overwritten with another one.
 template<class HW>
-void PDQ_GFX<HW>::getTextBounds(char *str, coord_t x, coord_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+void PDQ_GFX<HW>::clearGlyphCache()
 {
-	uint8_t c; // Current character
+#if PDQ_GLYPH_CACHE
+	for (GlyphCacheSlot *s = glyphCache; s < &glyphCache[PDQ_GLYPH_CACHE]; s++)
+		s->used = 0;
+#endif
+}
+
+// Pass string (in RAM or PROGMEM) and a cursor position, returns UL corner and W,H.
+// Lines wrap the same way write() would wrap them.
+template<class HW>
+void PDQ_GFX<HW>::textBounds(const uint8_t *str, uint8_t pgm, coord_t x, coord_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+{
+	uint16_t c; // Current character
 
 	*x1 = x;
 	*y1 = y;
@@ -1057,24 +3033,25 @@ void PDQ_GFX<HW>::getTextBounds(char *str, coord_t x, coord_t y, int16_t *x1, in
 	if (gfxFont)
 	{
 		GFXglyph *glyph;
-		uint8_t	first	= pgm_read_byte(&gfxFont->first);
-		uint8_t	last	= pgm_read_byte(&gfxFont->last);
+		uint16_t gi;
 		uint8_t	gw, gh, xa;
 		int8_t	xo, yo;
 		int16_t	minx = _width, miny = _height, maxx = -1, maxy = -1;
 		coord_t	gx1, gy1, gx2, gy2;
 		coord_t	ts = (coord_t)textsize, ya = (coord_t)textsize * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+		uint16_t prev = 0;
 
-		while((c = *str++))
+		while((c = textChar(str, pgm)))
 		{
 			if (c != '\n')	// Not a newline
 			{
 				if (c != '\r')	// Not a carriage return, is normal char
 				{
-					if ((c >= first) && (c <= last))	// Char present in current font
+					if ((gi = glyphIndex(c)) != 0xFFFF)	// Char present in current font
 					{
-						c		-= first;
-						glyph = &(((GFXglyph *)pgm_read_pointer(&gfxFont->glyph))[c]);
+						x		+= kerning(prev, c);
+						prev	= c;
+						glyph = &(((GFXglyph *)pgm_read_pointer(&gfxFont->glyph))[gi]);
 						gw		= pgm_read_byte(&glyph->width);
 						gh		= pgm_read_byte(&glyph->height);
 						xa		= pgm_read_byte(&glyph->xAdvance);
@@ -1084,6 +3061,7 @@ void PDQ_GFX<HW>::getTextBounds(char *str, coord_t x, coord_t y, int16_t *x1, in
 						{
 							x = 0;	// Reset x to 0
 							y += ya; // Advance y by 1 line
+							prev = 0;
 						}
 						gx1 = x	+ xo * ts;
 						gy1 = y	+ yo * ts;
@@ -1105,6 +3083,7 @@ void PDQ_GFX<HW>::getTextBounds(char *str, coord_t x, coord_t y, int16_t *x1, in
 			{
 				x	= 0;	// Reset x
 				y += ya; // Advance y by 1 line
+				prev = 0;
 			}
 		}
 		// End of string
@@ -1118,162 +3097,370 @@ void PDQ_GFX<HW>::getTextBounds(char *str, coord_t x, coord_t y, int16_t *x1, in
 	}
 	else	// Default font
 	{
-		uint16_t lineWidth = 0, maxWidth = 0; // Width of current, all lines
+		coord_t	cw = (coord_t)textsize * 6, ch = (coord_t)textsize * 8;
+		coord_t	minx = x, maxx = x;
+		uint8_t	used = 0; // any chars on current line
 
-		while((c = *str++))
+		while((c = textByte(str++, pgm)))
 		{
 			if (c != '\n') // Not a newline
 			{
 				if (c != '\r') // Not a carriage return, is normal char
 				{
-					lineWidth += textsize * 6; // Includes interchar x gap
-					if (wrap && (cursor_x > (_width - textsize*6)))
+					x += cw; // Includes interchar x gap
+					if (x > maxx)
+						maxx = x;
+					used = 1;
+					if (wrap && (x > (_width - cw)))	// Same test as write()
 					{
 						x = 0;
-						y += textsize*8;
-
-						if (lineWidth > maxWidth)	// Save widest line
-							maxWidth = lineWidth;
-						lineWidth	= textsize * 6; // First char on new line
+						y += ch;
+						used = 0;
+						minx = 0;
 					}
 				} // Carriage return = do nothing
 			}
 			else // Newline
 			{
-				x	= 0;						// Reset x to 0
-				y += textsize * 8; 				// Advance y by 1 line
-				if (lineWidth > maxWidth)		// Save widest line
-					maxWidth = lineWidth;
-				lineWidth = 0;					// Reset lineWidth for new line
+				x	= 0;		// Reset x to 0
+				y += ch; 		// Advance y by 1 line
+				used = 0;
+				minx = 0;
 			}
 		}
 		// End of string
-		if (lineWidth) 							// Add height of last (or only) line
-			y += textsize * 8;
-		if (lineWidth > maxWidth)				// Save widest line
-			maxWidth = lineWidth;
-		*w = maxWidth - 1;						// Don't include last interchar x gap
+		if (used) 							// Add height of last (or only) line
+			y += ch;
+		*x1 = minx;
+		if (maxx > minx)
+			*w = maxx - minx - 1;			// Don't include last interchar x gap
 		*h = y - *y1;
 
 	} // End classic vs custom font
 }
 
-// Same as above, but for PROGMEM strings
+// Read next character of string (in RAM or PROGMEM).  Strings are UTF-8 when the current font
+// is a Unicode (ranged) font, otherwise each byte is a character.
 template<class HW>
-void PDQ_GFX<HW>::getTextBounds(const __FlashStringHelper *str, coord_t x, coord_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+uint16_t PDQ_GFX<HW>::textChar(const uint8_t *&s, uint8_t pgm)
 {
-	uint8_t *s = (uint8_t *)str;
-	uint8_t c;
+	uint16_t c = textByte(s, pgm);
 
-	*x1 = x;
-	*y1 = y;
-	*w	= *h = 0;
+	if (!c)
+		return 0;
+	s++;
+	if (gfxFont && gfxRanges && (c & 0x80))
+	{
+		if ((c & 0xC0) == 0x80)		// stray continuation byte
+			return 0xFFFF;
+		uint8_t	n = (c >= 0xE0) ? ((c >= 0xF0) ? 3 : 2) : 1;
+		uint8_t	big = (c >= 0xF0);	// (no characters past 0xFFFF)
+		c &= 0x3F >> n;
+		for (; n; n--)
+		{
+			uint8_t b = textByte(s, pgm);
+			if ((b & 0xC0) != 0x80)
+				return 0xFFFF;
+			c = (c << 6) | (b & 0x3F);
+			s++;
+		}
+		if (big)
+			c = 0xFFFF;
+	}
 
-	if (gfxFont)
+	return c;
+}
+
+// Glyph array index of character in current font (0xFFFF if not present).  Unicode fonts
+// binary search their range table.
+template<class HW>
+uint16_t PDQ_GFX<HW>::glyphIndex(uint16_t c)
+{
+	if (!gfxRanges)
+		return ((c >= gfxFirst) && (c <= gfxLast)) ? c - gfxFirst : 0xFFFF;
+
+	uint16_t lo = 0, hi = gfxRangeCount;
+	while (lo < hi)
 	{
-		GFXglyph *glyph;
-		uint8_t	first	= pgm_read_byte(&gfxFont->first);
-		uint8_t	last	= pgm_read_byte(&gfxFont->last);
-		uint8_t			gw, gh, xa;
-		int8_t			xo, yo;
-		int16_t	minx = _width, miny = _height, maxx = -1, maxy = -1;
-		coord_t			gx1, gy1, gx2, gy2;
-		coord_t			ts = (coord_t)textsize;
-		coord_t			ya = ts * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+		uint16_t	mid		= (lo + hi) >> 1;
+		uint16_t	first	= pgm_read_word(&gfxRanges[mid].first);
+		if (c < first)
+			hi = mid;
+		else if (c > pgm_read_word(&gfxRanges[mid].last))
+			lo = mid + 1;
+		else
+			return pgm_read_word(&gfxRanges[mid].glyph) + (c - first);
+	}
 
-		while((c = pgm_read_byte(s++)))
+	return 0xFFFF;
+}
+
+// Scaled x advance of character in current font (0 if not drawn)
+template<class HW>
+coord_t PDQ_GFX<HW>::charAdvance(uint16_t c)
+{
+	if ((c == '\n') || (c == '\r'))
+		return 0;
+	if (!gfxFont)
+		return (coord_t)textsize * 6;
+
+	uint16_t gi = glyphIndex(c);
+	if (gi == 0xFFFF)
+		return 0;
+	if (gfxFixed)
+		return (coord_t)textsize * gfxFixed;
+	if (gfxAdvance)
+		return (coord_t)textsize * (uint8_t)pgm_read_byte(&gfxAdvance[gi]);
+	GFXglyph *glyph = &(((GFXglyph *)pgm_read_pointer(&gfxFont->glyph))[gi]);
+	return (coord_t)textsize * (uint8_t)pgm_read_byte(&glyph->xAdvance);
+}
+
+// Scaled kerning adjustment between characters prev and c.  Pairs for each left glyph are
+// found through the index and binary searched.  Opaque text is not kerned (so character
+// cells never overlap).
+template<class HW>
+coord_t PDQ_GFX<HW>::kerning(uint16_t prev, uint16_t c)
+{
+	if (!gfxKernIndex || !prev || (textbgcolor != textcolor))
+		return 0;
+
+	uint16_t	gl = glyphIndex(prev);
+	uint16_t	gr = glyphIndex(c);
+	if ((gl == 0xFFFF) || (gr == 0xFFFF))
+		return 0;
+
+	uint16_t	lo = pgm_read_word(&gfxKernIndex[gl]);
+	uint16_t	hi = pgm_read_word(&gfxKernIndex[gl + 1]);
+	while (lo < hi)
+	{
+		uint16_t	mid = (lo + hi) >> 1;
+		uint16_t	r	= pgm_read_word(&gfxKernPairs[mid].right);
+		if (r == gr)
+			return (coord_t)(int8_t)pgm_read_byte(&gfxKernPairs[mid].dx) * textsize;
+		if (r < gr)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return 0;
+}
+
+// Advance width of widest line of string (in RAM or PROGMEM), not including wrapping
+template<class HW>
+coord_t PDQ_GFX<HW>::textWidth(const uint8_t *s, uint8_t pgm)
+{
+	coord_t		w = 0, lw = 0;
+	uint16_t	c, prev = 0;
+
+	while ((c = textChar(s, pgm)))
+	{
+		if (c == '\n')
+			lw = prev = 0;
+		else
 		{
-			if (c != '\n') // Not a newline
+			lw += kerning(prev, c) + charAdvance(c);
+			prev = c;
+		}
+		if (lw > w)
+			w = lw;
+	}
+
+	return w;
+}
+
+// Draw character with its line cell top-left at x,y (for either font type)
+template<class HW>
+void PDQ_GFX<HW>::drawTextChar(coord_t x, coord_t y, uint16_t c)
+{
+	if ((c == '\n') || (c == '\r'))
+		return;
+	if (!gfxFont)
+		HW::drawChar(x, y, (uint8_t)c, textcolor, textbgcolor, textsize);
+	else if (glyphIndex(c) != 0xFFFF)
+		HW::drawCharGFX(x, y + (coord_t)gfxAscent * textsize, c, textcolor, textbgcolor, textsize);
+}
+
+// Lay out and draw text in a box.  For each line the text is scanned once to find the line
+// break (newline, word wrap or cut off point) and its width, then the line's characters are
+// drawn at their aligned positions.
+template<class HW>
+coord_t PDQ_GFX<HW>::textLayout(const uint8_t *s, uint8_t pgm, coord_t x, coord_t y, coord_t w, coord_t h, uint8_t flags)
+{
+	coord_t	lh		= (coord_t)textsize * (gfxFont ? (uint8_t)pgm_read_byte(&gfxFont->yAdvance) : 8);
+	coord_t	dw		= charAdvance('.');
+	coord_t	ew		= (flags & TEXT_ELLIPSIS) ? 3 * dw : 0;
+	uint8_t	opaque	= (textbgcolor != textcolor);
+	coord_t	ly		= y;
+	uint16_t c;
+
+	while (textByte(s, pgm) && (ly + lh <= y + h))
+	{
+		uint8_t			lastline	= (ly + 2*lh > y + h);	// no room for another line
+		const uint8_t	*p			= s;
+		const uint8_t	*brk		= 0;	// last space (word break)
+		const uint8_t	*fit		= s;	// end of text that still fits with an ellipsis
+		coord_t			lw			= 0;
+		coord_t			bw			= 0;
+		coord_t			fw			= 0;
+		uint16_t		prev		= 0;
+
+		// measure to end of line (or first character that doesn't fit)
+		while ((c = textByte(p, pgm)) && (c != '\n'))
+		{
+			const uint8_t *q = p;
+			c = textChar(q, pgm);
+			coord_t a = kerning(prev, c) + charAdvance(c);
+			prev = c;
+			if ((lw + a > w) && (flags & (TEXT_WORDWRAP | TEXT_ELLIPSIS)))
+				break;
+			if (c == ' ')
 			{
-				if (c != '\r') // Not a carriage return, is normal char
-				{
-					if ((c >= first) && (c <= last)) // Char present in current font
-					{
-						c		-= first;
-						glyph = &(((GFXglyph *)pgm_read_pointer(&gfxFont->glyph))[c]);
-						gw		= pgm_read_byte(&glyph->width);
-						gh		= pgm_read_byte(&glyph->height);
-						xa		= pgm_read_byte(&glyph->xAdvance);
-						xo		= pgm_read_byte(&glyph->xOffset);
-						yo		= pgm_read_byte(&glyph->yOffset);
-						if (wrap && ((x + (((int16_t)xo + gw) * ts)) >= _width)) // Line wrap
-						{
-							x	= 0;	// Reset x to 0
-							y += ya;	// Advance y by 1 line
-						}
-						gx1 = x	+ xo * ts;
-						gy1 = y	+ yo * ts;
-						gx2 = gx1 + gw * ts - 1;
-						gy2 = gy1 + gh * ts - 1;
-						if (gx1 < minx)
-							minx = gx1;
-						if (gy1 < miny)
-							miny = gy1;
-						if (gx2 > maxx)
-							maxx = gx2;
-						if (gy2 > maxy)
-							maxy = gy2;
-						x += xa * ts;
-					}
-				} // Carriage return = do nothing
+				brk = p;
+				bw	= lw;
 			}
-			else // Newline
+			lw += a;
+			p = q;
+			if (lw + ew <= w)
 			{
-				x	= 0;	// Reset x
-				y += ya;	// Advance y by 1 line
+				fit	= p;
+				fw	= lw;
 			}
 		}
-		// End of string
-		*x1 = minx;
-		*y1 = miny;
-		if (maxx >= minx)
-			*w	= maxx - minx + 1;
-		if (maxy >= miny)
-			*h	= maxy - miny + 1;
-
-	}
-	else	 // Default font
-	{
-		uint16_t lineWidth = 0, maxWidth = 0; // Width of current, all lines
 
-		while((c = pgm_read_byte(s++)))
+		const uint8_t	*e		= p;	// end of text drawn on this line
+		const uint8_t	*next	= p;	// start of next line
+		uint8_t			cut		= 0;	// line ends in ellipsis
+		if (c == '\n')
+			next++;
+		if (c && (c != '\n') && (flags & TEXT_WORDWRAP) && !lastline)
 		{
-			if (c != '\n') // Not a newline
+			// wrap at last space (dropping spaces at the break), or mid-word if no space
+			if (brk)
 			{
-				if (c != '\r') // Not a carriage return, is normal char
-				{
-					if (wrap && ((x + textsize * 6) >= _width))
-					{
-						x = 0;						// Reset x to 0
-						y += textsize * 8;			// Advance y by 1 line
-						if (lineWidth > maxWidth)	// Save widest line
-							maxWidth = lineWidth;
-						lineWidth	= textsize * 6; // First char on new line
-					}
-					else // No line wrap, just keep incrementing X
-					{
-						lineWidth += textsize * 6; // Includes interchar x gap
-					}
-				} // Carriage return = do nothing
+				e	= brk;
+				lw	= bw;
+				next = brk;
+				while (textByte(next, pgm) == ' ')
+					next++;
 			}
-			else // Newline
+			else if (p == s)
 			{
-				x = 0;								// Reset x to 0
-				y += textsize * 8;					// Advance y by 1 line
-				if (lineWidth > maxWidth)			// Save widest line
-					maxWidth = lineWidth;
-				lineWidth = 0;						// Reset lineWidth for new line
+				next = s;
+				lw = charAdvance(textChar(next, pgm));
+				e = next;
 			}
 		}
-		// End of string
-		if (lineWidth) 								// Add height of last (or only) line
-			y += textsize * 8;
-		if (lineWidth > maxWidth)				// Save widest line
-			maxWidth = lineWidth;
-		*w = maxWidth - 1;							// Don't include last interchar x gap
-		*h = y - *y1;
+		else if (c && (flags & TEXT_ELLIPSIS) && ((c != '\n') || (lastline && textByte(next, pgm))))
+		{
+			// text is cut off (at box edge, or more lines than fit)
+			if ((c != '\n') || (lw + ew > w))
+			{
+				e	= fit;
+				lw	= fw;
+			}
+			cut = 1;
+		}
+		if ((c && (c != '\n')) && !(flags & TEXT_WORDWRAP))
+		{
+			// line was cut off, skip rest of it
+			while ((c = textByte(next, pgm)) && (c != '\n'))
+				next++;
+			if (c)
+				next++;
+		}
 
-	} // End classic vs custom font
+		// dots of the ellipsis that fit (fewer than 3 only in a box narrower than "...")
+		uint8_t	dots = 0;
+		if (cut)
+		{
+			dots = 3;
+			if ((lw + ew > w) && (dw > 0))
+				dots = (w > lw) ? (w - lw) / dw : 0;
+		}
+
+		// alignment
+		coord_t lx = x;
+		coord_t tw = lw + dots * dw;
+		if (flags & TEXT_CENTER)
+			lx += (w - tw) / 2;
+		else if (flags & TEXT_RIGHT)
+			lx += w - tw;
+		if (opaque && (lx > x))
+			HW::fillRect(x, ly, lx - x, lh, textbgcolor);
+
+		for (p = s, prev = 0; p < e; )
+		{
+			c = textChar(p, pgm);
+			lx += kerning(prev, c);
+			drawTextChar(lx, ly, c);
+			lx += charAdvance(c);
+			prev = c;
+		}
+		for (uint8_t i = 0; i < dots; i++, lx += dw)
+			drawTextChar(lx, ly, '.');
+
+		if (opaque && (lx < x + w))
+			HW::fillRect(lx, ly, x + w - lx, lh, textbgcolor);
+
+		ly += lh;
+		s = next;
+		if (cut && lastline)
+			break;
+	}
+
+	if (opaque && (ly < y + h))
+		HW::fillRect(x, ly, w, y + h - ly, textbgcolor);
+
+	return ly - y;
+}
+
+// Rotated text is drawn in the display rotation it reads normally in (dir quarter turns on from
+// the current one), switched to only for the call.  Drivers set rotations with the controller's
+// address mode (MADCTL or entry mode), so glyphs stream through address windows exactly as
+// unrotated text does.  x,y is mapped into the rotated coordinates one quarter turn at a time.
+template<class HW>
+void PDQ_GFX<HW>::textRotated(const uint8_t *s, uint8_t pgm, coord_t x, coord_t y, uint8_t dir)
+{
+	uint8_t	r	= rotation;
+	coord_t	cx	= cursor_x;
+	coord_t	cy	= cursor_y;
+	coord_t	w	= _width;
+	coord_t	h	= _height;
+	uint16_t	lc	= lastChar;		// kerning and UTF-8 state of the text being written normally
+	uint16_t	uc	= utf8Char;
+	uint8_t	ul	= utf8Left;
+
+	dir &= 3;
+	for (uint8_t i = 0; i < dir; i++)
+	{
+		coord_t t = x;
+		x = y;
+		y = w - 1 - t;
+		swapValue(w, h);
+	}
+
+	if (dir)
+		HW::setRotation((r + dir) & 3);
+	cursor_x	= x;
+	cursor_y	= y;
+	lastChar	= 0;
+	utf8Left	= 0;
+	if (pgm)
+	{
+		uint8_t c;
+		while ((c = pgm_read_byte(s++)))
+			write(c);
+	}
+	else
+		write(s, strlen((const char *)s));
+	if (dir)
+		HW::setRotation(r);
+	cursor_x	= cx;
+	cursor_y	= cy;
+	lastChar	= lc;
+	utf8Char	= uc;
+	utf8Left	= ul;
 }
 
 template<class HW>
@@ -1370,4 +3557,151 @@ boolean PDQ_GFX_Button_<HW>::justReleased()
 	return (!currstate && laststate);
 }
 
+/***************************************************************************/
+// code for the GFX text field UI element
+
+template <class HW>
+PDQ_GFX_Field_<HW>::PDQ_GFX_Field_()
+{
+	_gfx = 0;
+}
+
+// Field box is x,y (top-left) w wide and one text line high, text aligned in it with TEXT_LEFT,
+// TEXT_CENTER or TEXT_RIGHT.  Nothing is drawn until drawField() or setText().  The font is
+// selected with setFont(font), so far fonts (see gfxfont.h) can't be used.
+template <class HW>
+void PDQ_GFX_Field_<HW>::initField(PDQ_GFX<HW> *gfx, coord_t x, coord_t y, coord_t w, const GFXfont *font, uint8_t textsize, color_t textcolor, color_t bgcolor, uint8_t align)
+{
+	_gfx		= gfx;
+	_x			= x;
+	_y			= y;
+	_w			= w;
+	_font		= font;
+	_textsize	= textsize;
+	_textcolor	= textcolor;
+	_bgcolor	= bgcolor;
+	_align		= align;
+	_len		= 0;
+	_left		= x;
+	_right		= x;
+}
+
+template <class HW>
+void PDQ_GFX_Field_<HW>::select()
+{
+	_gfx->setFont(_font);
+	_gfx->setTextSize(_textsize);
+	_gfx->setTextColor(_textcolor, _bgcolor);
+}
+
+template <class HW>
+void PDQ_GFX_Field_<HW>::drawField()
+{
+	select();
+	coord_t	lh	= (coord_t)_textsize * (_font ? (uint8_t)pgm_read_byte(&_font->yAdvance) : 8);
+
+	if (_left > _x)
+		HW::fillRect(_x, _y, _left - _x, lh, _bgcolor);
+	for (uint8_t i = 0; i < _len; i++)
+		PDQ_GFX<HW>::drawTextChar(_cellx[i], _y, _chars[i]);
+	if (_right < _x + _w)
+		HW::fillRect(_right, _y, _x + _w - _right, lh, _bgcolor);
+}
+
+// Lay out the new text, then draw only the cells whose character or position changed and
+// erase what the old text covered outside the new one.  Text that doesn't fit is cut off.
+template <class HW>
+void PDQ_GFX_Field_<HW>::setText(const char *s)
+{
+	uint16_t		chars[MAX_CHARS];
+	int16_t			cellx[MAX_CHARS];
+	uint8_t			n	= 0;
+	coord_t			tw	= 0;
+	uint16_t		c;
+	const uint8_t	*p	= (const uint8_t *)s;
+
+	select();
+	coord_t	lh	= (coord_t)_textsize * (_font ? (uint8_t)pgm_read_byte(&_font->yAdvance) : 8);
+
+	while ((n < MAX_CHARS) && (c = PDQ_GFX<HW>::textChar(p, false)))
+	{
+		coord_t a = PDQ_GFX<HW>::charAdvance(c);
+		if (!a)
+			continue;
+		if (tw + a > _w)
+			break;
+		chars[n]	= c;
+		cellx[n++]	= tw;
+		tw += a;
+	}
+
+	coord_t	left = _x;
+	if (_align & TEXT_CENTER)
+		left += (_w - tw) / 2;
+	else if (_align & TEXT_RIGHT)
+		left += _w - tw;
+
+	coord_t	right = left + tw;
+	if ((_left < left) && (_left < _right))
+		HW::fillRect(_left, _y, ((_right < left) ? _right : left) - _left, lh, _bgcolor);
+	for (uint8_t i = 0, j = 0; i < n; i++)
+	{
+		cellx[i] += left;
+		while ((j < _len) && (_cellx[j] < cellx[i]))
+			j++;
+		if ((j >= _len) || (_cellx[j] != cellx[i]) || (_chars[j] != chars[i]))
+			PDQ_GFX<HW>::drawTextChar(cellx[i], _y, chars[i]);
+	}
+	coord_t	e = (_left > right) ? _left : right;
+	if (_right > e)
+		HW::fillRect(e, _y, _right - e, lh, _bgcolor);
+
+	memcpy(_chars, chars, n * sizeof(chars[0]));
+	memcpy(_cellx, cellx, n * sizeof(cellx[0]));
+	_len	= n;
+	_left	= left;
+	_right	= right;
+}
+
+// Numbers that don't fit (in MAX_CHARS characters or the field width) fill the field with "#"
+// rather than showing wrong digits.  decimals is limited to what fits with a sign and leading 0.
+template <class HW>
+void PDQ_GFX_Field_<HW>::setValue(long value, uint8_t decimals)
+{
+	char			buf[MAX_CHARS + 3 * sizeof(long) + 3];	// digits of any long (or decimals + 1), point, sign
+	char			*p	= &buf[sizeof(buf) - 1];
+	unsigned long	v	= (value < 0) ? -(unsigned long)value : value;
+	uint8_t			d	= 0;
+
+	if (decimals > MAX_CHARS - 3)
+		decimals = MAX_CHARS - 3;
+	*p = 0;
+	do
+	{
+		*--p = '0' + v % 10;
+		v /= 10;
+		if (++d == decimals)
+			*--p = '.';
+	} while (v || (d <= decimals));
+	if (value < 0)
+		*--p = '-';
+
+	char *e = &buf[sizeof(buf) - 1];
+	select();
+	if ((e - p > MAX_CHARS) || (PDQ_GFX<HW>::getTextWidth(p) > _w))
+	{
+		for (p = e; e - p < MAX_CHARS; )	// as many as fit
+		{
+			*--p = '#';
+			if (PDQ_GFX<HW>::getTextWidth(p) > _w)
+			{
+				p++;
+				break;
+			}
+		}
+	}
+
+	setText(p);
+}
+
 #endif // _PDQ_GFX_H
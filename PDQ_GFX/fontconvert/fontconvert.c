@@ -8,16 +8,34 @@ fonts to be used with the Adafruit_GFX Arduino library.
 For UNIX-like systems.  Outputs to stdout; redirect to header file, e.g.:
   ./fontconvert ~/Library/Fonts/FreeSans.ttf 18 > FreeSans18pt7b.h
 
+With -p as first argument glyphs are run-length packed (the format
+PDQ_GFX draws as runs) wherever that is smaller than the plain bitmap.
+With -s glyphs are stored as lists of row spans instead, the fastest to
+draw but usually the largest.  Statistics for either are printed to
+stderr, comparing the bitmap size of all three formats.  With -a2 or -a4
+glyphs are anti-aliased, with 2 or 4 bits of coverage per pixel.  With
+-c glyphs are compressed (Huffman coded pixel runs), the smallest format,
+and the flash savings are reported.
+
 REQUIRES FREETYPE LIBRARY.  www.freetype.org
 
-Currently this only extracts the printable 7-bit ASCII chars of a font.
-Will eventually extend with some int'l chars a la ftGFX, not there yet.
-Keep 7-bit fonts around as an option in that case, more compact.
+By default this extracts the printable 7-bit ASCII chars of a font.
+Other first..last ranges (up to 255) or Unicode range lists can be
+given, see main().  To subset a font to the characters an application
+actually prints, name its source files (string and character literals
+are scanned) or text files (all characters) with @, e.g.:
+  ./fontconvert DSEG7Classic-Bold.ttf 32 @Clock.ino > DSEG7Classic_Bold32pts.h
+Values printed as numbers are not in the literals, so digits, '-' and
+'.' are added for source files.  Add anything else they print (e.g. hex
+digits or an exponent) as a range:
+  ./fontconvert DSEG7Classic-Bold.ttf 32 @Clock.ino 0x41-0x46 > ...
 
 See notes at end for glyph nomenclature & other tidbits.
 */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <ctype.h>
 #include <stdint.h>
 #include <ft2build.h>
@@ -46,66 +64,427 @@ void enbit(uint8_t value) {
 	}
 }
 
+// Run-length encode a glyph bitmap in the packed format PDQ_GFX
+// decodes: pixels in row order (runs continue across rows) as 4-bit
+// codes, bit 3 set for foreground and bits 0-2 run length - 1, two
+// codes per byte low nibble first.  Returns packed size in bytes.
+int packGlyph(FT_Bitmap *bitmap, uint8_t *out) {
+	int x, y, p, on = 0, run = 0, nibbles = 0;
+
+	for(y=0; y <= bitmap->rows; y++) {
+		for(x=0; x < bitmap->width; x++) {
+			p = (y < bitmap->rows) ? (bitmap->buffer[
+			  y * bitmap->pitch + x / 8] >> (7 - (x & 7))) & 1 : -1;
+			if(run && ((p != on) || (run == 8))) {
+				if(nibbles & 1) out[nibbles / 2] |= ((on << 3) | (run - 1)) << 4;
+				else            out[nibbles / 2]  =  (on << 3) | (run - 1);
+				nibbles++;
+				run = 0;
+			}
+			if(p < 0) break; // Flushed last run
+			on = p;
+			run++;
+		}
+	}
+	return (nibbles + 1) / 2;
+}
+
+// Convert a glyph bitmap to the row span format (GFX_ROW_SPANS): for
+// each row that differs from the row above, its y, number of spans and
+// x, length of each run of set pixels; ended by 0xFF.  Returns size in
+// bytes, and number of spans (line or rectangle draws) in *count.
+int spanGlyph(FT_Bitmap *bitmap, uint8_t *out, int *count) {
+	int x, y, x0, n = 0, row;
+
+	*count = 0;
+	for(y=0; y < bitmap->rows; y++) {
+		if((y > 0) && !memcmp(&bitmap->buffer[y * bitmap->pitch],
+		  &bitmap->buffer[(y - 1) * bitmap->pitch],
+		  (bitmap->width + 7) / 8)) continue; // Same spans as above
+		row      = n;
+		out[n++] = y;
+		out[n++] = 0;
+		for(x=0; x < bitmap->width; ) {
+			if(!(bitmap->buffer[y * bitmap->pitch + x / 8] &
+			  (0x80 >> (x & 7)))) {
+				x++;
+				continue;
+			}
+			for(x0=x++; (x < bitmap->width) &&
+			  (bitmap->buffer[y * bitmap->pitch + x / 8] &
+			  (0x80 >> (x & 7))); x++);
+			out[n++] = x0;
+			out[n++] = x - x0;
+			out[row + 1]++;
+			(*count)++;
+		}
+	}
+	out[n++] = 0xFF;
+	return n;
+}
+
+// Convert an 8-bit grayscale glyph bitmap to anti-aliased runs of
+// coverage levels (GFX_GRAY2 or GFX_GRAY4 for bpp 2 or 4), in row order
+// with runs continuing across rows.  Returns size in bytes.
+int grayGlyph(FT_Bitmap *bitmap, uint8_t *out, int bpp) {
+	int x, y, level, run = 0, prev = 0, n = 0,
+	    max = (1 << bpp) - 1, maxRun = 1 << (8 - bpp);
+
+	for(y=0; y < bitmap->rows; y++) {
+		for(x=0; x < bitmap->width; x++) {
+			level = (bitmap->buffer[y * bitmap->pitch + x] * max +
+			  127) / 255;
+			if(run && ((level != prev) || (run == maxRun))) {
+				out[n++] = (prev << (8 - bpp)) | (run - 1);
+				run = 0;
+			}
+			prev = level;
+			run++;
+		}
+	}
+	if(run) out[n++] = (prev << (8 - bpp)) | (run - 1);
+	return n;
+}
+
+// Huffman coding (GFX_HUFFMAN): glyphs are split into runs of pixels
+// alternating between background and set (starting with background, so
+// possibly of length 0), in row order continuing across rows.  Symbol
+// 63 stands for 63 pixels with the run continuing in the next symbol.
+// Symbols get canonical Huffman codes built from the whole font.
+#define HUFF_SYMBOLS 64
+#define HUFF_MAXLEN  15
+int huffLen[HUFF_SYMBOLS], huffCode[HUFF_SYMBOLS];
+
+// Split glyph bitmap into run symbols, returns number of symbols.
+int glyphRuns(FT_Bitmap *bitmap, int *out) {
+	int i, p, run = 0, on = 0, n = 0,
+	    pixels = bitmap->width * bitmap->rows;
+
+	for(i=0; i <= pixels; i++) {
+		p = (i < pixels) ? (bitmap->buffer[(i / bitmap->width) *
+		  bitmap->pitch + (i % bitmap->width) / 8] >>
+		  (7 - (i % bitmap->width) % 8)) & 1 : !on;
+		if(p != on) { // End of run (or last run)
+			for(; run >= HUFF_SYMBOLS - 1; run -= HUFF_SYMBOLS - 1)
+				out[n++] = HUFF_SYMBOLS - 1;
+			out[n++] = run;
+			run = 0;
+			on  = p;
+		}
+		run++;
+	}
+	return n;
+}
+
+// Build length-limited canonical Huffman codes from symbol counts
+// (frequencies are halved until no code is longer than HUFF_MAXLEN).
+void huffBuild(int *freq) {
+	int i, j, a, b, f[HUFF_SYMBOLS * 2], parent[HUFF_SYMBOLS * 2],
+	    nodes, maxLen, len, code;
+
+	do {
+		for(i=0; i<HUFF_SYMBOLS; i++) f[i] = freq[i];
+		for(i=0; i<HUFF_SYMBOLS*2; i++) parent[i] = -1;
+		for(nodes=HUFF_SYMBOLS; ; nodes++) { // Merge two rarest
+			for(a=b=-1, i=0; i<nodes; i++) {
+				if(!f[i] || (parent[i] >= 0)) continue;
+				if((a < 0) || (f[i] < f[a])) { b = a; a = i; }
+				else if((b < 0) || (f[i] < f[b])) b = i;
+			}
+			if(b < 0) break;
+			f[nodes]  = f[a] + f[b];
+			parent[a] = parent[b] = nodes;
+		}
+		for(maxLen=0, i=0; i<HUFF_SYMBOLS; i++) {
+			for(len=0, j=i; f[i] && (parent[j] >= 0); j=parent[j])
+				len++;
+			huffLen[i] = (f[i] && !len) ? 1 : len; // (single symbol)
+			if(huffLen[i] > maxLen) maxLen = huffLen[i];
+		}
+		if(maxLen > HUFF_MAXLEN) {
+			for(i=0; i<HUFF_SYMBOLS; i++)
+				if(freq[i]) freq[i] = (freq[i] + 1) / 2;
+		}
+	} while(maxLen > HUFF_MAXLEN);
+
+	// Canonical codes: by length, then symbol
+	for(code=0, len=1; len<=HUFF_MAXLEN; len++, code <<= 1) {
+		for(i=0; i<HUFF_SYMBOLS; i++)
+			if(huffLen[i] == len) huffCode[i] = code++;
+	}
+}
+
+// Code table at start of bitmap: number of codes of each length, then
+// symbols in code order.  Returns size in bytes.
+int huffTable(uint8_t *out) {
+	int i, len, n = HUFF_MAXLEN;
+
+	for(len=1; len<=HUFF_MAXLEN; len++) {
+		out[len - 1] = 0;
+		for(i=0; i<HUFF_SYMBOLS; i++) {
+			if(huffLen[i] == len) {
+				out[len - 1]++;
+				out[n++] = i;
+			}
+		}
+	}
+	return n;
+}
+
+// Huffman code a glyph bitmap (MSB first, padded to a byte boundary).
+// Returns size in bytes.
+int huffGlyph(FT_Bitmap *bitmap, uint8_t *out, int *runs) {
+	int i, b, n, bits = 0, count = glyphRuns(bitmap, runs);
+
+	for(i=0; i<count; i++) {
+		for(b=huffLen[runs[i]]-1; b>=0; b--, bits++) {
+			if(!(bits & 7)) out[bits / 8] = 0;
+			if((huffCode[runs[i]] >> b) & 1)
+				out[bits / 8] |= 0x80 >> (bits & 7);
+		}
+	}
+	n = (bits + 7) / 8;
+	return n;
+}
+
+// Parse a character range list such as "32-126,0xA0-0xFF" (decimal
+// or hex, single characters allowed), appending to first[]/last[].
+// Returns updated number of ranges, or -1 on syntax error.
+#define MAX_RANGES 64
+int parseRanges(char *arg, int *first, int *last, int n) {
+	char *end;
+	while(*arg) {
+		if(n >= MAX_RANGES) return -1;
+		first[n] = last[n] = strtol(arg, &end, 0);
+		if(end == arg) return -1;
+		arg = end;
+		if(*arg == '-') {
+			last[n] = strtol(++arg, &end, 0);
+			if(end == arg) return -1;
+			arg = end;
+		}
+		if(last[n] < first[n] || last[n] > 0xFFFF) return -1;
+		n++;
+		if(*arg == ',') arg++;
+		else if(*arg) return -1;
+	}
+	return n;
+}
+
+// Decode a UTF-8 character at *p, advancing p.  Characters beyond
+// 0xFFFF and malformed bytes decode as 0.
+int utf8Decode(const unsigned char **p) {
+	int c = *(*p)++, n, i;
+
+	if(c < 0x80)      return c;
+	if(c < 0xC0)      return 0;
+	if(c < 0xE0)      { n = 1; c &= 0x1F; }
+	else if(c < 0xF0) { n = 2; c &= 0x0F; }
+	else              { n = 3; c  = 0x10000; }
+	for(i=0; i<n; i++) {
+		if((**p & 0xC0) != 0x80) return 0;
+		c = (c << 6) | (*(*p)++ & 0x3F);
+	}
+	return (c > 0xFFFF) ? 0 : c;
+}
+
+// Mark characters used by an application in used[].  Source files
+// (.ino, .c, .cpp, .h) have the text of their string and character
+// literals scanned, skipping comments and #include lines; any other
+// file is taken as plain text.  Control characters are left out.
+// Numbers printed with print(value) don't appear in literals, so for
+// source files the digits, '-' and '.' are always marked as well.
+// Returns number of characters marked (repeats included), -1 on error.
+int scanText(const char *path, uint8_t *used) {
+	FILE                *f;
+	unsigned char       *buf;
+	const unsigned char *p, *end;
+	const char          *ext;
+	long                 len;
+	int                  c, n = 0, source = 0, quote = 0;
+
+	if((ext = strrchr(path, '.')) && (!strcmp(ext, ".ino") ||
+	   !strcmp(ext, ".c") || !strcmp(ext, ".cpp") ||
+	   !strcmp(ext, ".h") || !strcmp(ext, ".pde"))) source = 1;
+	if(!(f = fopen(path, "rb"))) return -1;
+	fseek(f, 0, SEEK_END);
+	len = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	if(!(buf = malloc(len + 1))) {
+		fclose(f);
+		return -1;
+	}
+	len = fread(buf, 1, len, f);
+	buf[len] = 0;
+	fclose(f);
+
+	if(source) {
+		for(p=(const unsigned char *)"0123456789-."; *p; p++)
+			used[*p] = 1;
+	}
+	for(p=buf, end=buf+len; p < end; ) {
+		if(source && !quote) {
+			if((p[0] == '/') && (p[1] == '/')) {
+				while((p < end) && (*p != '\n')) p++;
+			} else if((p[0] == '/') && (p[1] == '*')) {
+				for(p+=2; (p < end) && !((p[0] == '*') &&
+				  (p[1] == '/')); p++);
+				p += 2;
+			} else if(!strncmp((const char *)p, "#include", 8)) {
+				while((p < end) && (*p != '\n')) p++;
+			} else if((*p == '"') || (*p == '\'')) {
+				quote = *p++;
+			} else p++;
+			continue;
+		}
+		if(source && (*p == quote)) { // End of literal
+			quote = 0;
+			p++;
+			continue;
+		}
+		if(source && (*p == '\\')) { // Escape: \\, \" and \' are
+			p++;                 // printed, others (\n...) not
+			if((*p != '\\') && (*p != '"') && (*p != '\'')) {
+				if(*p == 'x') while(isxdigit(*++p));
+				else if((*p >= '0') && (*p <= '7'))
+					while((*++p >= '0') && (*p <= '7'));
+				else p++;
+				continue;
+			}
+		}
+		if((c = utf8Decode(&p)) >= ' ' && (c != 0x7F)) {
+			used[c] = 1;
+			n++;
+		}
+	}
+	free(buf);
+	return n;
+}
+
 int main(int argc, char *argv[]) {
 	int                i, j, err, size, first=' ', last='~',
-	                   bitmapOffset = 0, x, y, byte;
+	                   bitmapOffset = 0, x, y, byte,
+	                   ascent = 0, descent = 0, fixedWidth = 1,
+	                   k, dx, numPairs = 0, numGlyphs = 0, numRanges = 0,
+	                   rangeFirst[MAX_RANGES], rangeLast[MAX_RANGES],
+	                   unicode = 0, *code, *offset, large = 0,
+	                   pack = 0, numPacked = 0, rawBytes = 0, n,
+	                   spans = 0, numSpans = 0, packBytes = 0,
+	                   spanBytes = 0, gray = 0, grayBytes = 0,
+	                   huff = 0, huffFreq[HUFF_SYMBOLS], *runs,
+	                   subset = 0, numUsed = 0;
+	char               flags[64];
 	char              *fontName, c, *ptr;
 	FT_Library         library;
 	FT_Face            face;
 	FT_Glyph           glyph;
 	FT_Bitmap         *bitmap;
 	FT_BitmapGlyphRec *g;
+	FT_Vector          delta;
 	GFXglyph          *table;
-	uint8_t            bit;
+	GFXkernPair       *pairs = NULL;
+	uint16_t          *kernIndex = NULL;
+	uint8_t            bit, *packed, *used;
 
 	// Parse command line.  Valid syntaxes are:
 	//   fontconvert [filename] [size]
 	//   fontconvert [filename] [size] [last char]
 	//   fontconvert [filename] [size] [first char] [last char]
+	//   fontconvert [filename] [size] [range list|@file] ...
+	// each optionally preceded by -p for packed glyphs, -s for
+	// row spans, -c for compressed glyphs or -a2/-a4 for
+	// anti-aliased glyphs.
 	// Unless overridden, default first and last chars are
-	// ' ' (space) and '~', respectively
-
+	// ' ' (space) and '~', respectively.  A range list (e.g.
+	// 32-126,0xC0-0x17F,0x410-0x44F) makes a Unicode font: only
+	// characters present in the font file are kept, and the
+	// sketch prints them as UTF-8 text.  @file adds the characters
+	// used in an application source or text file (see scanText()),
+	// so the font holds only what the sketch prints.
+
+	if((argc > 1) && (!strcmp(argv[1], "-p") || !strcmp(argv[1], "-s") ||
+	   !strcmp(argv[1], "-a2") || !strcmp(argv[1], "-a4") ||
+	   !strcmp(argv[1], "-c"))) {
+		if(argv[1][1] == 'p')      pack  = 1;
+		else if(argv[1][1] == 'c') huff  = 1;
+		else if(argv[1][1] == 's') spans = 1;
+		else                       gray  = argv[1][2] - '0';
+		argv[1] = argv[0];
+		argv++;
+		argc--;
+	}
 	if(argc < 3) {
-		fprintf(stderr, "Usage: %s fontfile size [first] [last]\n",
-		  argv[0]);
+		fprintf(stderr, "Usage: %s [-p|-s|-c|-a2|-a4] fontfile size [first] [last]\n"
+		  "       %s [-p|-s|-c|-a2|-a4] fontfile size range[,range...]|@file ...\n",
+		  argv[0], argv[0]);
 		return 1;
 	}
 
 	size = atoi(argv[2]);
 
-	if(argc == 4) {
-		last  = atoi(argv[3]);
-	} else if(argc == 5) {
-		first = atoi(argv[3]);
-		last  = atoi(argv[4]);
+	if(!(used = (uint8_t *)calloc(0x10000, 1))) {
+		fprintf(stderr, "Malloc error\n");
+		return 1;
 	}
+	for(i=3; i<argc; i++) {
+		if(strchr(argv[i], '-') || strchr(argv[i], ',')) unicode = 1;
+		if(argv[i][0] == '@') unicode = subset = 1;
+	}
+	if(unicode) {
+		for(i=3; i<argc; i++) {
+			if(argv[i][0] == '@') {
+				if((n = scanText(&argv[i][1], used)) < 0) {
+					fprintf(stderr, "Can't read %s\n",
+					  &argv[i][1]);
+					return 1;
+				}
+				numUsed += n;
+			} else if((numRanges = parseRanges(argv[i], rangeFirst,
+			  rangeLast, numRanges)) < 0) {
+				fprintf(stderr, "Bad range list: %s\n", argv[i]);
+				return 1;
+			}
+		}
+	} else {
+		if(argc == 4) {
+			last  = atoi(argv[3]);
+		} else if(argc == 5) {
+			first = atoi(argv[3]);
+			last  = atoi(argv[4]);
+		}
 
-	if(last < first) {
-		i     = first;
-		first = last;
-		last  = i;
+		if(last < first) {
+			i     = first;
+			first = last;
+			last  = i;
+		}
+		rangeFirst[0] = first;
+		rangeLast[0]  = last;
+		numRanges     = 1;
 	}
 
 	ptr = strrchr(argv[1], '/'); // Find last slash in filename
 	if(ptr) ptr++;         // First character of filename (path stripped)
 	else    ptr = argv[1]; // No path; font in local dir.
 
-	// Allocate space for font name and glyph table
+	// Allocate space for font name and character codes
 	if((!(fontName = malloc(strlen(ptr) + 20))) ||
-	   (!(table = (GFXglyph *)malloc((last - first + 1) *
-	    sizeof(GFXglyph))))) {
+	   (!(code = (int *)malloc(0x10000 * sizeof(int))))) {
 		fprintf(stderr, "Malloc error\n");
 		return 1;
 	}
 
 	// Derive font table names from filename.  Period (filename
-	// extension) is truncated and replaced with the font size & bits.
+	// extension) is truncated and replaced with the font size & bits
+	// (or 'u' for Unicode fonts, 's' for subsets).
 	strcpy(fontName, ptr);
 	ptr = strrchr(fontName, '.'); // Find last period (file ext)
 	if(!ptr) ptr = &fontName[strlen(fontName)]; // If none, append
 	// Insert font size and 7/8 bit.  fontName was alloc'd w/extra
 	// space to allow this, we're not sprintfing into Forbidden Zone.
-	sprintf(ptr, "%dpt%db", size, (last > 127) ? 8 : 7);
+	if(subset)       sprintf(ptr, "%dpts", size);
+	else if(unicode) sprintf(ptr, "%dptu", size);
+	else        sprintf(ptr, "%dpt%db", size, (last > 127) ? 8 : 7);
 	// Space and punctuation chars in name replaced w/ underscores.  
 	for(i=0; (c=fontName[i]); i++) {
 		if(isspace(c) || ispunct(c)) fontName[i] = '_';
@@ -125,33 +504,109 @@ int main(int argc, char *argv[]) {
 	// << 6 because '26dot6' fixed-point format
 	FT_Set_Char_Size(face, size << 6, 0, DPI, 0);
 
-	// Currently all symbols from 'first' to 'last' are processed.
-	// Fonts may contain WAY more glyphs than that, but this code
-	// will need to handle encoding stuff to deal with extracting
-	// the right symbols, and that's not done yet.
-	// fprintf(stderr, "%ld glyphs\n", face->num_glyphs);
+	// List character codes to convert.  A first..last font has every
+	// code in its range; a Unicode font only the ones the font file
+	// has glyphs for (in ascending order, duplicates dropped).
+	for(i=0; i<=0xFFFF; i++) {
+		for(j=0; j<numRanges; j++) {
+			if((i >= rangeFirst[j]) && (i <= rangeLast[j])) break;
+		}
+		if(((j < numRanges) || used[i]) &&
+		   (!unicode || FT_Get_Char_Index(face, i))) {
+			code[numGlyphs++] = i;
+		} else if(used[i]) {
+			fprintf(stderr, "Character 0x%04X not in font\n", i);
+		}
+	}
+	if(subset) {
+		fprintf(stderr, "%d characters scanned, %d glyphs\n",
+		  numUsed, numGlyphs);
+	}
+	if(!numGlyphs) {
+		fprintf(stderr, "No characters in range\n");
+		return 1;
+	}
+	if((!(table = (GFXglyph *)malloc(numGlyphs * sizeof(GFXglyph)))) ||
+	   (!(offset = (int *)malloc(numGlyphs * sizeof(int)))) ||
+	   (!(packed = (uint8_t *)malloc(256 * 256 * 2))) ||
+	   (!(runs = (int *)malloc((256 * 256 + 2) * sizeof(int))))) {
+		fprintf(stderr, "Malloc error\n");
+		return 1;
+	}
+
+	// Compressed fonts: count run symbols of all glyphs for the codes,
+	// their table comes first in the bitmap.
+	if(huff) {
+		memset(huffFreq, 0, sizeof(huffFreq));
+		for(j=0; j<numGlyphs; j++) {
+			if(FT_Load_Char(face, code[j], FT_LOAD_TARGET_MONO) ||
+			   FT_Render_Glyph(face->glyph, FT_RENDER_MODE_MONO))
+				continue;
+			n = glyphRuns(&face->glyph->bitmap, runs);
+			for(k=0; k<n; k++) huffFreq[runs[k]]++;
+		}
+		huffBuild(huffFreq);
+		bitmapOffset = huffTable(packed);
+	}
 
-	printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
+	// Bitmaps over 32KB don't fit the 15-bit bitmapOffset (bit 15 is
+	// the packed glyph flag).  Such fonts get a table of offset bits
+	// 16-22 per glyph and far bitmaps (see gfxfont.h), so size the
+	// bitmap before writing it out.
+	for(j=0; j<numGlyphs; j++) {
+		if(FT_Load_Char(face, code[j],
+		     gray ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO) ||
+		   FT_Render_Glyph(face->glyph,
+		     gray ? FT_RENDER_MODE_NORMAL : FT_RENDER_MODE_MONO)) continue;
+		bitmap = &face->glyph->bitmap;
+		n      = (bitmap->width * bitmap->rows + 7) / 8;
+		if(pack && ((k = packGlyph(bitmap, packed)) < n)) n = k;
+		if(spans) n = spanGlyph(bitmap, packed, &k);
+		if(gray)  n = grayGlyph(bitmap, packed, gray);
+		if(huff)  n = huffGlyph(bitmap, packed, runs);
+		bitmapOffset += n;
+	}
+	if(bitmapOffset > 0x7FFFFF) {
+		fprintf(stderr, "Font bitmap too large (%d bytes)\n",
+		  bitmapOffset);
+		return 1;
+	}
+	large        = (bitmapOffset > 0x7FFF);
+	bitmapOffset = 0;
+
+	printf("const uint8_t %sBitmaps[] %s = {\n  ", fontName,
+	  large ? "GFX_FAR_PROGMEM" : "PROGMEM");
+	if(huff) {
+		k = huffTable(packed);
+		for(x=0; x<k; x++) {
+			for(bit=0x80; bit; bit >>= 1)
+				enbit(packed[x] & bit);
+		}
+		bitmapOffset = k;
+	}
 
 	// Process glyphs and output huge bitmap data array
-	for(i=first, j=0; i<=last; i++, j++) {
+	for(j=0; j<numGlyphs; j++) {
+		i = code[j];
 		// MONO renderer provides clean image with perfect crop
-		// (no wasted pixels) via bitmap struct.
-		if((err = FT_Load_Char(face, i, FT_LOAD_TARGET_MONO))) {
-			fprintf(stderr, "Error %d loading char '%c'\n",
+		// (no wasted pixels) via bitmap struct.  Anti-aliased
+		// fonts use the 8-bit grayscale renderer instead.
+		if((err = FT_Load_Char(face, i,
+		  gray ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO))) {
+			fprintf(stderr, "Error %d loading char 0x%04X\n",
 			  err, i);
 			continue;
 		}
 
 		if((err = FT_Render_Glyph(face->glyph,
-		  FT_RENDER_MODE_MONO))) {
-			fprintf(stderr, "Error %d rendering char '%c'\n",
+		  gray ? FT_RENDER_MODE_NORMAL : FT_RENDER_MODE_MONO))) {
+			fprintf(stderr, "Error %d rendering char 0x%04X\n",
 			  err, i);
 			continue;
 		}
 
 		if((err = FT_Get_Glyph(face->glyph, &glyph))) {
-			fprintf(stderr, "Error %d getting glyph '%c'\n",
+			fprintf(stderr, "Error %d getting glyph 0x%04X\n",
 			  err, i);
 			continue;
 		}
@@ -163,17 +618,73 @@ int main(int argc, char *argv[]) {
 		// reduce flash space requirements.  Glyph bitmaps are
 		// fully bit-packed; no per-scanline pad, though end of
 		// each character may be padded to next byte boundary
-		// when needed.  16-bit offset means 64K max for bitmaps,
-		// code currently doesn't check for overflow.  (Doesn't
-		// check that size & offsets are within bounds either for
-		// that matter...please convert fonts responsibly.)
-		table[j].bitmapOffset = bitmapOffset;
+		// when needed.  Large fonts keep the low 16 bits of the
+		// offset in the glyph and the rest in a separate table.
+		// (Doesn't check that size & offsets are within bounds
+		// either...please convert fonts responsibly.)
+		offset[j]             = bitmapOffset;
+		table[j].bitmapOffset = bitmapOffset & 0xFFFF;
 		table[j].width        = bitmap->width;
 		table[j].height       = bitmap->rows;
 		table[j].xAdvance     = face->glyph->advance.x >> 6;
 		table[j].xOffset      = g->left;
 		table[j].yOffset      = 1 - g->top;
 
+		// Packed glyphs (see packGlyph()) are flagged in bit 15
+		// of the offset, or bit 7 of the high offset byte.
+		n = (bitmap->width * bitmap->rows + 7) / 8;
+		rawBytes  += n;
+		packBytes += ((k = packGlyph(bitmap, packed)) < n) ? k : n;
+		if(huff) {
+			table[j].bitmapOffset = bitmapOffset & 0xFFFF;
+			k = huffGlyph(bitmap, packed, runs);
+			for(x=0; x<k; x++) {
+				for(bit=0x80; bit; bit >>= 1)
+					enbit(packed[x] & bit);
+			}
+			bitmapOffset += k;
+			FT_Done_Glyph(glyph);
+			continue;
+		}
+		if(gray) {
+			table[j].bitmapOffset = bitmapOffset & 0xFFFF;
+			k = grayGlyph(bitmap, packed, gray);
+			for(x=0; x<k; x++) {
+				for(bit=0x80; bit; bit >>= 1)
+					enbit(packed[x] & bit);
+			}
+			bitmapOffset += k;
+			grayBytes    += (bitmap->width * bitmap->rows * gray + 7) / 8;
+			FT_Done_Glyph(glyph);
+			continue;
+		}
+		if(spans) {
+			table[j].bitmapOffset = bitmapOffset & 0xFFFF;
+			k = spanGlyph(bitmap, packed, &n);
+			for(x=0; x<k; x++) {
+				for(bit=0x80; bit; bit >>= 1)
+					enbit(packed[x] & bit);
+			}
+			bitmapOffset += k;
+			spanBytes    += k;
+			numSpans     += n;
+			FT_Done_Glyph(glyph);
+			continue;
+		}
+		if(pack && ((k = packGlyph(bitmap, packed)) < n)) {
+			offset[j]             = bitmapOffset | 0x800000;
+			table[j].bitmapOffset = large ? (bitmapOffset & 0xFFFF) :
+			                          (bitmapOffset | 0x8000);
+			for(x=0; x<k; x++) {
+				for(bit=0x80; bit; bit >>= 1)
+					enbit(packed[x] & bit);
+			}
+			bitmapOffset += k;
+			numPacked++;
+			FT_Done_Glyph(glyph);
+			continue;
+		}
+
 		for(y=0; y < bitmap->rows; y++) {
 			for(x=0;x < bitmap->width; x++) {
 				byte = x / 8;
@@ -184,7 +695,7 @@ int main(int argc, char *argv[]) {
 		}
 
 		// Pad end of char bitmap to next byte boundary if needed
-		int n = (bitmap->width * bitmap->rows) & 7;
+		n = (bitmap->width * bitmap->rows) & 7;
 		if(n) { // Pixel count not an even multiple of 8?
 			n = 8 - n; // # bits to next multiple
 			while(n--) enbit(0);
@@ -198,7 +709,8 @@ int main(int argc, char *argv[]) {
 
 	// Output glyph attributes table (one per character)
 	printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", fontName);
-	for(i=first, j=0; i<=last; i++, j++) {
+	for(j=0; j<numGlyphs; j++) {
+		i = code[j];
 		printf("  { %5d, %3d, %3d, %3d, %4d, %4d }",
 		  table[j].bitmapOffset,
 		  table[j].width,
@@ -206,29 +718,186 @@ int main(int argc, char *argv[]) {
 		  table[j].xAdvance,
 		  table[j].xOffset,
 		  table[j].yOffset);
-		if(i < last) {
-			printf(",   // 0x%02X", i);
-			if((i >= ' ') && (i <= '~')) {
-				printf(" '%c'", i);
+		printf((j < numGlyphs-1) ? ",   " : " }; ");
+		if(unicode) printf("// U+%04X", i);
+		else        printf("// 0x%02X", i);
+		if((i >= ' ') && (i <= '~')) {
+			printf(" '%c'", i);
+		}
+		putchar('\n');
+	}
+	putchar('\n');
+
+	// Large fonts: bitmapOffset bits 16-22 of each glyph (bit 7 flags
+	// a packed glyph)
+	if(large) {
+		printf("const uint8_t %sBitmapHigh[] PROGMEM = {\n  ",
+		  fontName);
+		for(j=0; j<numGlyphs; j++) {
+			printf("%3d", offset[j] >> 16);
+			if(j < numGlyphs-1)
+				printf((j % 16 == 15) ? ",\n  " : ",");
+		}
+		printf(" };\n\n");
+	}
+
+	// Unicode fonts: ranges of consecutive character codes, each with
+	// the index of its first glyph (end marked by first > last).
+	if(unicode) {
+		printf("const GFXrange %sRanges[] PROGMEM = {\n", fontName);
+		for(j=0, numRanges=0; j<numGlyphs; j=k, numRanges++) {
+			for(k=j+1; (k<numGlyphs) && (code[k] == code[k-1]+1); k++);
+			printf("  { 0x%04X, 0x%04X, %5d },\n",
+			  code[j], code[k-1], j);
+		}
+		printf("  { 0xFFFF, 0x0000, %5d } };\n\n", numGlyphs);
+	}
+
+	// Font-wide metrics, so text can be measured without reading
+	// every glyph: ascent/descent (rows above/below the baseline row)
+	// and an xAdvance table (omitted if all advances are the same).
+	for(j=0; j<numGlyphs; j++) {
+		if(-table[j].yOffset > ascent)
+			ascent = -table[j].yOffset;
+		if(table[j].yOffset + table[j].height - 1 > descent)
+			descent = table[j].yOffset + table[j].height - 1;
+		if(table[j].xAdvance != table[0].xAdvance)
+			fixedWidth = 0;
+	}
+	if(!fixedWidth) {
+		printf("const uint8_t %sAdvances[] PROGMEM = {\n  ", fontName);
+		for(j=0; j<numGlyphs; j++) {
+			printf("%3d", table[j].xAdvance);
+			if(j < numGlyphs-1)
+				printf((j % 16 == 15) ? ",\n  " : ",");
+		}
+		printf(" };\n\n");
+	}
+	printf("const GFXmetrics %sMetrics PROGMEM = {\n", fontName);
+	sprintf(flags, "%s%s%s%s%s",
+	  fixedWidth  ? " | GFX_FIXED_WIDTH" : "",
+	  spans       ? " | GFX_ROW_SPANS" : "",
+	  huff        ? " | GFX_HUFFMAN" : "",
+	  (gray == 2) ? " | GFX_GRAY2" : "",
+	  (gray == 4) ? " | GFX_GRAY4" : "");
+	printf("  %d, %d, %s, %d, ", ascent, descent,
+	  flags[0] ? &flags[3] : "0",
+	  fixedWidth ? table[0].xAdvance : 0);
+	if(fixedWidth) printf("NULL };\n\n");
+	else           printf("(uint8_t *)%sAdvances };\n\n", fontName);
+
+	// Kerning pairs from the font's 'kern' table (grid fitted to
+	// whole pixels at this size), grouped by left glyph with an
+	// index of where each group starts.  Only non-zero pairs stored.
+	if(FT_HAS_KERNING(face)) {
+		if((!(kernIndex = (uint16_t *)malloc((numGlyphs + 1) *
+		    sizeof(uint16_t)))) ||
+		   (!(pairs = (GFXkernPair *)malloc(numGlyphs *
+		    numGlyphs * sizeof(GFXkernPair))))) {
+			fprintf(stderr, "Malloc error\n");
+			return 1;
+		}
+		for(j=0; j<numGlyphs; j++) {
+			kernIndex[j] = numPairs;
+			for(k=0; k<numGlyphs; k++) {
+				if(FT_Get_Kerning(face,
+				  FT_Get_Char_Index(face, code[j]),
+				  FT_Get_Char_Index(face, code[k]),
+				  FT_KERNING_DEFAULT, &delta)) continue;
+				dx = delta.x >> 6;
+				if(dx < -128) dx = -128;
+				if(dx >  127) dx =  127;
+				if(dx) {
+					pairs[numPairs].right = k;
+					pairs[numPairs].dx    = dx;
+					numPairs++;
+				}
 			}
-			putchar('\n');
 		}
+		kernIndex[j] = numPairs;
+	}
+	if(numPairs) {
+		printf("const uint16_t %sKernIndex[] PROGMEM = {\n  ",
+		  fontName);
+		for(j=0; j<=numGlyphs; j++) {
+			printf("%4d", kernIndex[j]);
+			if(j < numGlyphs)
+				printf((j % 12 == 11) ? ",\n  " : ",");
+		}
+		printf(" };\n\n");
+		printf("const GFXkernPair %sKernPairs[] PROGMEM = {\n  ",
+		  fontName);
+		for(j=0; j<numPairs; j++) {
+			printf("{ %3d, %3d }", pairs[j].right, pairs[j].dx);
+			if(j < numPairs-1)
+				printf((j % 6 == 5) ? ",\n  " : ", ");
+		}
+		printf(" };\n\n");
+		printf("const GFXkerning %sKerning PROGMEM = {\n", fontName);
+		printf("  (uint16_t *)%sKernIndex,\n", fontName);
+		printf("  (GFXkernPair *)%sKernPairs };\n\n", fontName);
 	}
-	printf(" }; // 0x%02X", last);
-	if((last >= ' ') && (last <= '~')) printf(" '%c'", last);
-	printf("\n\n");
 
 	// Output font structure
 	printf("const GFXfont %s PROGMEM = {\n", fontName);
-	printf("  (uint8_t  *)%sBitmaps,\n", fontName);
+	if(large) printf("  GFX_FAR_BITMAP(%sBitmaps),\n", fontName);
+	else      printf("  (uint8_t  *)%sBitmaps,\n", fontName);
 	printf("  (GFXglyph *)%sGlyphs,\n", fontName);
-	printf("  0x%02X, 0x%02X, %ld };\n\n",
-	  first, last, face->size->metrics.height >> 6);
+	printf("  0x%02X, 0x%02X, %ld,\n",
+	  unicode ? 0 : first, unicode ? 0 : last,
+	  face->size->metrics.height >> 6);
+	printf("  (GFXmetrics *)&%sMetrics,\n", fontName);
+	if(numPairs) printf("  (GFXkerning *)&%sKerning,\n", fontName);
+	else         printf("  NULL,\n");
+	if(unicode)  printf("  (GFXrange *)%sRanges,\n", fontName);
+	else         printf("  NULL,\n");
+	if(large)    printf("  (uint8_t *)%sBitmapHigh };\n\n", fontName);
+	else         printf("  NULL };\n\n");
+	if(large) {
+		printf("// Large font, on AVRs over 64KB flash select with:\n");
+		printf("//   setFont(&%s, GFX_FAR_ADDRESS(%sBitmaps));\n\n",
+		  fontName, fontName);
+	}
 	printf("// Approx. %d bytes\n",
-	  bitmapOffset + (last - first + 1) * 7 + 7);
+	  bitmapOffset + numGlyphs * 7 + 15 + (large ? numGlyphs : 0) +
+	  (fixedWidth ? 0 : numGlyphs) + 6 +
+	  (numPairs ? (numGlyphs + 1) * 2 + numPairs * 3 + 4 : 0) +
+	  (unicode ? (numRanges + 1) * 6 : 0));
 	// Size estimate is based on AVR struct and pointer sizes;
 	// actual size may vary.
 
+	if(pack) {
+		fprintf(stderr, "%s: %d of %d glyphs packed, "
+		  "bitmaps %d -> %d bytes (%d%%)\n", fontName, numPacked,
+		  numGlyphs, rawBytes, bitmapOffset,
+		  rawBytes ? bitmapOffset * 100 / rawBytes : 100);
+	}
+	// Row spans trade flash for speed: no bits decoded when drawing,
+	// one line draw per span.  Report both sides so the format can be
+	// chosen per font.
+	if(huff) {
+		fprintf(stderr, "%s: compressed bitmaps %d bytes "
+		  "(incl. %d byte code table) vs %d plain, saving %d (%d%%), "
+		  "%d packed\n", fontName, bitmapOffset, huffTable(packed),
+		  rawBytes, rawBytes - bitmapOffset,
+		  rawBytes ? (rawBytes - bitmapOffset) * 100 / rawBytes : 0,
+		  packBytes);
+	}
+	if(gray) {
+		fprintf(stderr, "%s: %d bits per pixel anti-aliased, "
+		  "bitmaps %d bytes vs %d unpacked (%d%%)\n", fontName, gray,
+		  bitmapOffset, grayBytes,
+		  grayBytes ? bitmapOffset * 100 / grayBytes : 100);
+	}
+	if(spans) {
+		fprintf(stderr, "%s: %d span draws (%d.%d per glyph), "
+		  "bitmaps %d bytes vs %d plain (%d%%), %d packed (%d%%)\n",
+		  fontName, numSpans, numSpans / numGlyphs,
+		  numSpans * 10 / numGlyphs % 10, spanBytes, rawBytes,
+		  rawBytes ? spanBytes * 100 / rawBytes : 100, packBytes,
+		  rawBytes ? packBytes * 100 / rawBytes : 100);
+	}
+
 	FT_Done_FreeType(library);
 
 	return 0;
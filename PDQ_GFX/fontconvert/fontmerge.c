@@ -0,0 +1,321 @@
+/*
+Font merger for PDQ_GFX: combines several fontconvert output headers into
+one, with all glyph bitmaps in a single shared pool.  Identical glyph
+bitmaps (punctuation, digits, glyphs common to a regular and an oblique
+style, etc.) are stored only once, so a sketch using several fonts needs
+less flash.
+
+NOT AN ARDUINO SKETCH.  This is a command-line tool, outputs to stdout;
+redirect to header file and include it instead of the separate fonts:
+  ./fontmerge UIFonts ../Fonts/FreeSans9pt7b.h ../Fonts/FreeSans12pt7b.h \
+    ../Fonts/FreeSansBold12pt7b.h > UIFonts.h
+
+Font names and their tables are kept, only the bitmap arrays are replaced
+by the pool (named after the first argument).  Savings are reported on
+stderr.  Fonts whose bitmap starts with a code table (fontconvert -c) can
+not share a pool and are rejected.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define MAX_FONTS 64
+
+typedef struct {
+	char    *text;      // Header file contents
+	char     name[128]; // Font name (prefix of Bitmaps array)
+	uint8_t *bitmap;    // Glyph bitmaps
+	int      size;      // ...and their size in bytes
+	int      numGlyphs;
+	int     *offset;    // Offset of each glyph's bitmap (in font, then pool)
+	int     *packed;    // Packed flag of each glyph
+	int     *length;    // Bitmap bytes of each glyph
+	int      high;      // Has a BitmapHigh table
+} Font;
+
+// Read whole file, returns NULL on error.
+char *readFile(const char *path) {
+	FILE *f;
+	char *buf;
+	long  n;
+
+	if(!(f = fopen(path, "rb"))) return NULL;
+	fseek(f, 0, SEEK_END);
+	n = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	if((buf = malloc(n + 1))) {
+		buf[fread(buf, 1, n, f)] = 0;
+	}
+	fclose(f);
+	return buf;
+}
+
+// Find start of array "<name><suffix>[]" definition, its '{' in *open
+// and closing '}' in *close.  Returns NULL if not found.
+char *findArray(char *text, const char *name, const char *suffix,
+  char **open, char **close) {
+	char  key[160], *p;
+
+	sprintf(key, "%s%s[]", name, suffix);
+	if(!(p = strstr(text, key))) return NULL;
+	*open  = strchr(p, '{');
+	*close = strstr(*open, "};");
+	while((p > text) && (p[-1] != '\n')) p--; // Start of line
+	return p;
+}
+
+// Parse numbers in text from p to end into out[], returns count.
+int parseNumbers(char *p, char *end, int *out) {
+	int   n = 0;
+	char *e;
+
+	while(p < end) {
+		if(((*p >= '0') && (*p <= '9')) || (*p == '-')) {
+			out[n++] = strtol(p, &e, 0);
+			p = e;
+		} else if((p[0] == '/') && (p[1] == '/')) { // Skip comment
+			while((p < end) && (*p != '\n')) p++;
+		} else p++;
+	}
+	return n;
+}
+
+// Load font header, returns 0 on success.
+int loadFont(const char *path, Font *font) {
+	char *p, *open, *close, *q;
+	int  *num, i, j, n, high[65536];
+
+	if(!(font->text = readFile(path))) {
+		fprintf(stderr, "Can't read %s\n", path);
+		return 1;
+	}
+	if(strstr(font->text, "GFX_HUFFMAN")) {
+		fprintf(stderr, "%s: compressed fonts can't be merged\n", path);
+		return 1;
+	}
+	if(!(p = strstr(font->text, "Bitmaps[]"))) {
+		fprintf(stderr, "%s: no Bitmaps array\n", path);
+		return 1;
+	}
+	for(q=p; (q > font->text) && (q[-1] != ' '); q--);
+	memcpy(font->name, q, p - q);
+	font->name[p - q] = 0;
+
+	num = malloc(strlen(font->text) * sizeof(int));
+	findArray(font->text, font->name, "Bitmaps", &open, &close);
+	font->size   = parseNumbers(open + 1, close, num);
+	font->bitmap = malloc(font->size + 1);
+	for(i=0; i<font->size; i++) font->bitmap[i] = num[i];
+
+	if(!findArray(font->text, font->name, "Glyphs", &open, &close)) {
+		fprintf(stderr, "%s: no Glyphs array\n", path);
+		return 1;
+	}
+	n = parseNumbers(open + 1, close, num);
+	font->numGlyphs = n / 6;
+	font->offset    = malloc(font->numGlyphs * sizeof(int));
+	font->packed    = malloc(font->numGlyphs * sizeof(int));
+	font->length    = malloc(font->numGlyphs * sizeof(int));
+
+	font->high = 0;
+	if(findArray(font->text, font->name, "BitmapHigh", &open, &close)) {
+		parseNumbers(open + 1, close, high);
+		font->high = 1;
+	}
+	for(i=0; i<font->numGlyphs; i++) {
+		font->offset[i] = num[i * 6];
+		if(font->high) {
+			font->packed[i]  = high[i] >> 7;
+			font->offset[i] |= (high[i] & 0x7F) << 16;
+		} else {
+			font->packed[i]  = font->offset[i] >> 15;
+			font->offset[i] &= 0x7FFF;
+		}
+	}
+	free(num);
+
+	// Glyph bitmaps are contiguous; each ends where the next one
+	// (in bitmap order) starts, or at the end of the array.
+	for(i=0; i<font->numGlyphs; i++) {
+		font->length[i] = font->size - font->offset[i];
+		for(j=0; j<font->numGlyphs; j++) {
+			n = font->offset[j] - font->offset[i];
+			if((n > 0) && (n < font->length[i])) font->length[i] = n;
+		}
+	}
+	return 0;
+}
+
+// Output bytes of a PROGMEM array, 12 per line.
+void printBytes(uint8_t *data, int n) {
+	int i;
+
+	printf("  ");
+	for(i=0; i<n; i++) {
+		printf("0x%02X", data[i]);
+		if(i < n-1) printf((i % 12 == 11) ? ",\n  " : ", ");
+	}
+	printf(" };\n\n");
+}
+
+int main(int argc, char *argv[]) {
+	Font     font[MAX_FONTS];
+	uint8_t *pool;
+	int      numFonts, poolSize = 0, total = 0, shared = 0, glyphs = 0,
+	         large, f, g, h, found, n, approx, *unique, *uniqueLen,
+	         numUnique = 0;
+	char    *p, *open, *close, *start, *end, key[160];
+
+	if((argc < 3) || (argc - 2 > MAX_FONTS)) {
+		fprintf(stderr, "Usage: %s poolname font.h font.h ...\n",
+		  argv[0]);
+		return 1;
+	}
+	numFonts = argc - 2;
+	for(f=0; f<numFonts; f++) {
+		if(loadFont(argv[f + 2], &font[f])) return 1;
+		total += font[f].size;
+	}
+
+	// Build pool: each glyph bitmap is added unless an identical one
+	// is already in it (offsets now point into the pool)
+	for(f=0, n=0; f<numFonts; f++) n += font[f].numGlyphs;
+	pool      = malloc(total + 1);
+	unique    = malloc(n * sizeof(int));
+	uniqueLen = malloc(n * sizeof(int));
+	for(f=0; f<numFonts; f++) {
+		for(g=0; g<font[f].numGlyphs; g++) {
+			n = font[f].length[g];
+			for(found=-1, h=0; (h<numUnique) && n; h++) {
+				if((uniqueLen[h] == n) && !memcmp(&pool[unique[h]],
+				  &font[f].bitmap[font[f].offset[g]], n)) {
+					found = unique[h];
+					break;
+				}
+			}
+			glyphs++;
+			if(found >= 0) {
+				shared++;
+			} else {
+				found                  = poolSize;
+				unique[numUnique]      = poolSize;
+				uniqueLen[numUnique++] = n;
+				memcpy(&pool[poolSize],
+				  &font[f].bitmap[font[f].offset[g]], n);
+				poolSize += n;
+			}
+			font[f].offset[g] = n ? found : 0;
+		}
+	}
+	if(poolSize > 0x7FFFFF) {
+		fprintf(stderr, "Pool too large (%d bytes)\n", poolSize);
+		return 1;
+	}
+	large = (poolSize > 0x7FFF);
+
+	printf("// Shared glyph bitmap pool of");
+	for(f=0; f<numFonts; f++) printf(" %s", font[f].name);
+	printf("\n// %d bytes (%d before merging)\n", poolSize, total);
+	printf("const uint8_t %sBitmaps[] %s = {\n", argv[1],
+	  large ? "GFX_FAR_PROGMEM" : "PROGMEM");
+	printBytes(pool, poolSize);
+	if(large) {
+		printf("// Large pool, on AVRs over 64KB flash select fonts with:\n");
+		printf("//   setFont(&%s, GFX_FAR_ADDRESS(%sBitmaps));\n\n",
+		  font[0].name, argv[1]);
+	}
+
+	// Fonts: original header with the bitmap array left out, glyph
+	// offsets rewritten and bitmap pointer to the pool
+	for(f=0; f<numFonts; f++) {
+		Font *fn = &font[f];
+
+		p = fn->text;
+		start = findArray(p, fn->name, "Bitmaps", &open, &close);
+		fwrite(p, 1, start - p, stdout);
+		p = close + 2;
+		while((*p == '\n') || (*p == '\r')) p++;
+
+		// Glyph table, replacing first number of each entry
+		start = findArray(p, fn->name, "Glyphs", &open, &close);
+		fwrite(p, 1, start - p, stdout);
+		for(g=0, p=start; p<close; p++) {
+			if((*p == '/') && (p[1] == '/')) { // Copy comment
+				for(; *p != '\n'; p++) putchar(*p);
+				putchar('\n');
+				continue;
+			}
+			putchar(*p);
+			if((*p == '{') && (p > open)) {
+				strtol(p + 1, &end, 0);
+				n = large ? (fn->offset[g] & 0xFFFF) :
+				  (fn->offset[g] | (fn->packed[g] << 15));
+				printf(" %5d", n);
+				p = end - 1;
+				g++;
+			}
+		}
+
+		// Rest, with high offset table rewritten or added
+		sprintf(key, "const GFXfont %s ", fn->name);
+		end = strstr(p, key);
+		if(fn->high) {
+			start = findArray(p, fn->name, "BitmapHigh", &open,
+			  &close);
+			fwrite(p, 1, start - p, stdout);
+			p = close + 2;
+			while((*p == '\n') || (*p == '\r')) p++;
+		} else {
+			fwrite(p, 1, end - p, stdout);
+			p = end;
+		}
+		if(large) {
+			printf("const uint8_t %sBitmapHigh[] PROGMEM = {\n",
+			  fn->name);
+			printf("  ");
+			for(g=0; g<fn->numGlyphs; g++) {
+				printf("%3d", (fn->offset[g] >> 16) |
+				  (fn->packed[g] << 7));
+				if(g < fn->numGlyphs-1)
+					printf((g % 16 == 15) ? ",\n  " : ",");
+			}
+			printf(" };\n\n");
+		}
+		// GFXfont struct, bitmap pointer (first field) to the pool
+		// (NULL on AVRs where a large pool is far, see gfxfont.h)
+		open  = strchr(end, '{');
+		close = strchr(open, ',');
+		fwrite(p, 1, open + 1 - p, stdout);
+		if(large) printf("\n  GFX_FAR_BITMAP(%sBitmaps)", argv[1]);
+		else      printf("\n  (uint8_t  *)%sBitmaps", argv[1]);
+		p   = close;
+		end = strstr(p, "};");
+		for(; p<end; p++) {
+			if(!strncmp(p, "NULL", 4) && large &&
+			  !memchr(p + 4, ',', end - (p + 4))) { // Last field
+				printf("(uint8_t *)%sBitmapHigh", fn->name);
+				p += 3;
+			} else putchar(*p);
+		}
+
+		// Size estimate without the bitmap (now in the pool)
+		if((start = strstr(p, "// Approx. "))) {
+			fwrite(p, 1, start - p, stdout);
+			approx = atoi(start + 11);
+			printf("// Approx. %d bytes (bitmaps in %sBitmaps)",
+			  approx - fn->size + (large && !fn->high ?
+			  fn->numGlyphs : 0), argv[1]);
+			p = strchr(start, '\n');
+		}
+		fputs(p, stdout);
+	}
+
+	fprintf(stderr, "%s: %d fonts, %d of %d glyphs shared, bitmaps "
+	  "%d -> %d bytes, saving %d (%d%%)\n", argv[1], numFonts, shared,
+	  glyphs, total, poolSize, total - poolSize,
+	  total ? (total - poolSize) * 100 / total : 0);
+
+	return 0;
+}
@@ -12,7 +12,15 @@
 # (huge zipfile, different license) but they're easily acquired:
 # http://savannah.gnu.org/projects/freefont/
 
+# Pass -p to generate packed (run-length) fonts, usually a good deal
+# smaller at larger sizes, or -c for compressed fonts, smaller still;
+# fontconvert reports the savings per font.
+
 convert=./fontconvert
+if [ "$1" = "-p" ] || [ "$1" = "-c" ]
+  then
+	convert="./fontconvert $1"
+fi
 inpath=~/Desktop/freefont/
 outpath=../Fonts/
 fonts=(FreeMono FreeSans FreeSerif)
@@ -10,20 +10,82 @@
 #ifndef _GFXFONT_H_
 #define _GFXFONT_H_
 
-struct GFXglyph	// Data stored PER GLYPH
+typedef struct	// Data stored PER GLYPH
 {
 	uint16_t bitmapOffset;     // Pointer into GFXfont->bitmap
 	uint8_t  width, height;    // Bitmap dimensions in pixels
 	uint8_t  xAdvance;         // Distance to advance cursor (x axis)
 	int8_t   xOffset, yOffset; // Dist from cursor pos to UL corner
-};
+} GFXglyph;
 
-struct GFXfont	// Data stored for FONT AS A WHOLE:
+#define GFX_FIXED_WIDTH	0x01	// GFXmetrics flag, all glyphs have the same xAdvance
+#define GFX_ROW_SPANS	0x02	// GFXmetrics flag, glyph bitmaps are row span lists: for each row
+								// that differs from the one above y, span count and x, length of
+								// each run of set pixels (spans repeat down to the next y), ended
+								// by 0xFF
+#define GFX_GRAY2		0x04	// GFXmetrics flag, anti-aliased glyphs with 2 bits of coverage per
+								// pixel as runs (bits 7-6 level, 5-0 length-1)
+#define GFX_GRAY4		0x08	// GFXmetrics flag, anti-aliased glyphs with 4 bits of coverage per
+								// pixel as runs (bits 7-4 level, 3-0 length-1)
+#define GFX_HUFFMAN		0x10	// GFXmetrics flag, glyphs are Huffman coded run lengths, with the
+								// code table at the start of the bitmap
+
+typedef struct	// Optional font-wide metrics (generated by fontconvert)
+{
+	int8_t    ascent;      // Rows above baseline (tallest glyph)
+	int8_t    descent;     // Rows below baseline (deepest descender)
+	uint8_t   flags;       // GFX_FIXED_WIDTH, GFX_ROW_SPANS, GFX_GRAY2, GFX_GRAY4, GFX_HUFFMAN
+	uint8_t   xAdvance;    // Advance of every glyph (when GFX_FIXED_WIDTH)
+	uint8_t  *advance;     // xAdvance per glyph (NULL when GFX_FIXED_WIDTH)
+} GFXmetrics;
+
+typedef struct	// Kerning pair (left glyph is implied by GFXkerning index)
+{
+	uint16_t  right;       // Glyph index of right character of pair
+	int8_t    dx;          // Adjustment to xAdvance of left character
+} GFXkernPair;
+
+typedef struct	// Optional kerning table (generated by fontconvert)
+{
+	uint16_t    *index;    // Start of pairs for each left glyph (plus one past last glyph)
+	GFXkernPair *pairs;    // Pairs grouped by left glyph, sorted by right glyph
+} GFXkerning;
+
+typedef struct	// Character range of a Unicode font (sparse glyph set)
+{
+	uint16_t  first, last; // Character codes in range (inclusive)
+	uint16_t  glyph;       // Glyph array index of first
+} GFXrange;
+
+typedef struct	// Data stored for FONT AS A WHOLE:
 {
 	uint8_t  *bitmap;      // Glyph bitmaps, concatenated
 	GFXglyph *glyph;       // Glyph array
 	uint8_t   first, last; // ASCII extents
 	uint8_t   yAdvance;    // Newline distance (y axis)
-};
+	// Fields below are optional (older fonts leave them zero)
+	GFXmetrics *metrics;   // Font metrics and per glyph advance table (or NULL)
+	GFXkerning *kerning;   // Kerning pairs (or NULL)
+	GFXrange   *ranges;    // Sorted Unicode ranges ended by first > last (NULL uses first/last)
+	uint8_t    *bitmapHigh; // Per glyph bitmapOffset bits 16-22, bit 7 packed (NULL if under 32KB)
+} GFXfont;
+
+// Bitmaps of large fonts (over 32KB) are declared GFX_FAR_PROGMEM.  On AVRs with more than
+// 64KB of flash this places them after the program code, so the font's other tables stay in
+// the low 64KB.  A 16-bit pointer can't reach them, so there GFX_FAR_BITMAP leaves the GFXfont
+// bitmap field NULL and the sketch passes GFX_FAR_ADDRESS(bitmaps) to setFont().  On other
+// targets it is the usual pointer and plain setFont(&font) works.
+// Caveat: .fini7 is part of the exit code, the .fini sections are run by falling through from
+// one to the next.  If exit() is called (or main() returns) the font data is executed as code,
+// so sketches using far fonts must never exit (Arduino's loop() doesn't).
+#if defined(__AVR_HAVE_ELPM__)
+	#define GFX_FAR_PROGMEM		__attribute__((section(".fini7")))
+	#define GFX_FAR_ADDRESS(sym)	pgm_get_far_address(sym)
+	#define GFX_FAR_BITMAP(sym)		((uint8_t *)NULL)
+#else
+	#define GFX_FAR_PROGMEM		PROGMEM
+	#define GFX_FAR_ADDRESS(sym)	((uintptr_t)(sym))
+	#define GFX_FAR_BITMAP(sym)		((uint8_t *)(sym))
+#endif
 
 #endif // _GFXFONT_H_
@@ -536,6 +536,7 @@ class PDQ_ILI9340 : public PDQ_GFX<PDQ_ILI9340>
 };
 
 typedef PDQ_GFX_Button_<PDQ_ILI9340>	PDQ_GFX_Button;
+typedef PDQ_GFX_Field_<PDQ_ILI9340>	PDQ_GFX_Field;
 
 /***************************************************
   This is an Arduino Library for the Adafruit 2.2" SPI display.
@@ -778,7 +779,7 @@ void PDQ_ILI9340::drawFastHLine(int x, int y, int w, uint16_t color)
 		return;
 
 	if (x1 > _width) 
-		w = _width-w;
+		w = _width-x;
 
 	spi_begin();
 	
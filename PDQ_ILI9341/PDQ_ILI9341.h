@@ -540,6 +540,7 @@ class PDQ_ILI9341 : public PDQ_GFX<PDQ_ILI9341>
 };
 
 typedef PDQ_GFX_Button_<PDQ_ILI9341>	PDQ_GFX_Button;
+typedef PDQ_GFX_Field_<PDQ_ILI9341>	PDQ_GFX_Field;
 
 /***************************************************
   This is an Arduino Library for the Adafruit 2.2" SPI display.
@@ -782,7 +783,7 @@ void PDQ_ILI9341::drawFastHLine(int x, int y, int w, uint16_t color)
 		return;
 
 	if (x1 > _width) 
-		w = _width-w;
+		w = _width-x;
 
 	spi_begin();
 	
@@ -802,7 +802,7 @@ void PDQ_ST7735::drawFastHLine(int x, int y, int w, uint16_t color)
 		return;
 
 	if (x1 > _width) 
-		w = _width-w;
+		w = _width-x;
 
 	spi_begin();
 	
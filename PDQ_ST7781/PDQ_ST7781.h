@@ -606,7 +606,7 @@ void PDQ_ST7781::drawFastHLine(int x, int y, int w, uint16_t color)
 		return;
 
 	if (x1 > _width) 
-		w = _width-w;
+		w = _width-x;
 
 	lcd_begin();
 	